@@ -98,6 +98,19 @@ namespace BINDER_SPACE
 
         sTrustedPlatformAssemblies.Normalize();
 
+        // The TPA list of a large app can contain thousands of entries. Pre-size the map
+        // so that populating it does not repeatedly grow the table, rehashing the simple
+        // name of every entry added so far on each growth.
+        COUNT_T assemblyCount = 1;
+        for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); i++)
+        {
+            if (*i == PATH_SEPARATOR_CHAR_W)
+            {
+                assemblyCount++;
+            }
+        }
+        m_pTrustedPlatformAssemblyMap->Reallocate(assemblyCount * 2);
+
         for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
         {
             SString fileName;
@@ -5,6 +5,27 @@
 
 extern int g_readProcessMemoryErrno;
 
+// Returns true if the buffer contains nothing but zeros
+static bool
+IsZeroBlock(const uint8_t* buffer, size_t size)
+{
+    size_t words = size / sizeof(uint64_t);
+    const uint64_t* wordBuffer = (const uint64_t*)buffer;
+    for (size_t i = 0; i < words; i++)
+    {
+        if (wordBuffer[i] != 0) {
+            return false;
+        }
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++)
+    {
+        if (buffer[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Write the core dump file:
 //   ELF header
 //   Single section header (Shdr) for 64 bit program header count
@@ -170,6 +191,7 @@ DumpWriter::WriteDump()
 
     // Read from target process and write memory regions to core
     uint64_t total = 0;
+    uint64_t zeroBytesSkipped = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
         uint64_t address = memoryRegion.StartAddress();
@@ -200,7 +222,19 @@ DumpWriter::WriteDump()
                     return false;
                 }
 
-                if (!WriteData(m_tempBuffer, read)) {
+                // Untouched pages read back as all zeros; instead of writing them seek
+                // past, leaving a hole in the core file. Holes read back as zeros so
+                // the dump is unchanged for the debugger, but regions of memory that
+                // were committed and never touched cost neither time nor disk space.
+                if (IsZeroBlock(m_tempBuffer, read))
+                {
+                    if (lseek(m_fd, (off_t)read, SEEK_CUR) == (off_t)-1) {
+                        printf_error("Error seeking in dump file: %s (%d)\n", strerror(errno), errno);
+                        return false;
+                    }
+                    zeroBytesSkipped += read;
+                }
+                else if (!WriteData(m_tempBuffer, read)) {
                     return false;
                 }
 
@@ -210,7 +244,16 @@ DumpWriter::WriteDump()
         }
     }
 
-    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
+    // If the dump ends with skipped zero pages the file ends in a hole; extend the
+    // file to the current position so it has the size the program headers describe.
+    off_t current = lseek(m_fd, 0, SEEK_CUR);
+    if (current == (off_t)-1 || ftruncate(m_fd, current) == -1) {
+        printf_error("Error extending dump file: %s (%d)\n", strerror(errno), errno);
+        return false;
+    }
+
+    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages) to core file, %" PRId64 " zero pages elided\n",
+        total, total / PAGE_SIZE, zeroBytesSkipped / PAGE_SIZE);
     return true;
 }
 
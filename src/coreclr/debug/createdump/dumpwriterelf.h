@@ -42,7 +42,7 @@ class DumpWriter
 private:
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    BYTE m_tempBuffer[0x10000];
 
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
@@ -1431,6 +1431,134 @@ SplitName::CdNextDomainType(CLRDATA_ENUM* handle,
                               split->m_nameFlags, appDomain, token);
 }
 
+//----------------------------------------------------------------------------
+//
+// DacTargetBlockCache.
+//
+// Block-granular read-through cache sitting below the instance cache. Unlike
+// the instances, which must keep each object's data sequential, this cache
+// works on raw aligned blocks of target memory, so it can satisfy the many
+// small ReadVirtual requests a heap walk issues with one target round trip
+// per block.
+//
+//----------------------------------------------------------------------------
+
+DacTargetBlockCache::DacTargetBlockCache(void)
+{
+    ZeroMemory(m_blocks, sizeof(m_blocks));
+}
+
+DacTargetBlockCache::~DacTargetBlockCache(void)
+{
+    for (ULONG32 i = 0; i < NUM_BLOCKS; i++)
+    {
+        delete [] m_blocks[i].data;
+    }
+}
+
+DacTargetBlockCache::Block*
+DacTargetBlockCache::GetBlock(TADDR base)
+{
+    Block* block = &m_blocks[(size_t)(base / BLOCK_SIZE) % NUM_BLOCKS];
+    if ((block->base == base) && (block->data != NULL))
+    {
+        return block;
+    }
+
+    if (block->data == NULL)
+    {
+        block->data = new (nothrow) BYTE[BLOCK_SIZE];
+        if (block->data == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    block->base = base;
+    block->valid = 0;
+
+    ULONG32 returned = 0;
+    HRESULT status = g_dacImpl->m_pTarget->
+        ReadVirtual(base, block->data, BLOCK_SIZE, &returned);
+    if (status == S_OK)
+    {
+        block->valid = returned;
+    }
+
+    // A failed block read leaves valid at zero, which records that the block
+    // cannot be read from its start; requests that fall into it go straight
+    // to the target without retrying the block fetch.
+    return block;
+}
+
+bool
+DacTargetBlockCache::Read(TADDR addr, PVOID buffer, ULONG32 size)
+{
+    // Requests larger than a block go straight to the target.
+    if ((size == 0) || (size > BLOCK_SIZE))
+    {
+        return false;
+    }
+
+    TADDR base = addr & ~(TADDR)(BLOCK_SIZE - 1);
+    Block* block = GetBlock(base);
+    if (block == NULL)
+    {
+        return false;
+    }
+
+    ULONG32 offset = (ULONG32)(addr - base);
+    if ((ULONG64)offset + size <= block->valid)
+    {
+        memcpy(buffer, block->data + offset, size);
+        return true;
+    }
+
+    // A request crossing into the following block can be served when this
+    // block is valid all the way to its end.
+    if (((ULONG64)offset + size > BLOCK_SIZE) && (block->valid == BLOCK_SIZE))
+    {
+        ULONG32 first = BLOCK_SIZE - offset;
+        memcpy(buffer, block->data + offset, first);
+        return Read(addr + first, (PBYTE)buffer + first, size - first);
+    }
+
+    return false;
+}
+
+void
+DacTargetBlockCache::Invalidate(TADDR addr, ULONG32 size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    TADDR base = addr & ~(TADDR)(BLOCK_SIZE - 1);
+    TADDR last = (addr + size - 1) & ~(TADDR)(BLOCK_SIZE - 1);
+    for (; base <= last; base += BLOCK_SIZE)
+    {
+        Block* block = &m_blocks[(size_t)(base / BLOCK_SIZE) % NUM_BLOCKS];
+        if (block->base == base)
+        {
+            block->base = 0;
+            block->valid = 0;
+        }
+    }
+}
+
+void
+DacTargetBlockCache::Flush(void)
+{
+    // Drop the cached contents but keep the data buffers; they are reused as
+    // soon as the target is read again after the flush.
+    for (ULONG32 i = 0; i < NUM_BLOCKS; i++)
+    {
+        m_blocks[i].base = 0;
+        m_blocks[i].valid = 0;
+    }
+}
+
 //----------------------------------------------------------------------------
 //
 // DacInstanceManager.
@@ -3281,6 +3409,9 @@ ClrDataAccess::Flush(void)
     // Free instance memory.
     m_instances.Flush();
 
+    // Drop cached target memory blocks; the target may change while running.
+    m_blockCache.Flush();
+
     // When the host instance cache is flushed we
     // update the instance age count so that
     // all child objects automatically become
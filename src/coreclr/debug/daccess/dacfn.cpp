@@ -158,8 +158,16 @@ DacReadAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
     nStart = GetCycleCount();
 #endif // #if defined(DAC_MEASURE_PERF)
 
-    status = g_dacImpl->m_pTarget->
-        ReadVirtual(addr, (PBYTE)buffer, size, &returned);
+    if (g_dacImpl->m_blockCache.Read(addr, buffer, size))
+    {
+        status = S_OK;
+        returned = size;
+    }
+    else
+    {
+        status = g_dacImpl->m_pTarget->
+            ReadVirtual(addr, (PBYTE)buffer, size, &returned);
+    }
 
 #if defined(DAC_MEASURE_PERF)
     nEnd = GetCycleCount();
@@ -209,6 +217,8 @@ DacWriteAll(TADDR addr, PVOID buffer, ULONG32 size, bool throwEx)
         return status;
     }
 
+    g_dacImpl->m_blockCache.Invalidate(addr, size);
+
     return S_OK;
 }
 
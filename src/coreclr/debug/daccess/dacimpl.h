@@ -648,6 +648,67 @@ struct DumpMemoryReportStatics
 };
 
 
+//----------------------------------------------------------------------------
+//
+// DacTargetBlockCache.
+//
+// Read-through cache of aligned blocks of target memory. The DAC reads target
+// memory in small object-sized requests; when the target is a large dump the
+// per-request round trip through the data target dominates operations like
+// heap walks. Reads are satisfied from aligned blocks that are each fetched
+// with a single ReadVirtual, so a linear walk pays one round trip per block
+// instead of one per object. The cache follows the same consistency model as
+// DacInstanceManager: the target must be frozen while it is in use and it is
+// flushed whenever the instance cache is flushed.
+//
+//----------------------------------------------------------------------------
+
+class DacTargetBlockCache
+{
+public:
+    DacTargetBlockCache(void);
+    ~DacTargetBlockCache(void);
+
+    // Try to satisfy a read from cached blocks, fetching blocks from the
+    // target on miss. Returns false when the range cannot be served, in which
+    // case the caller falls back to reading the target directly.
+    bool Read(TADDR addr, PVOID buffer, ULONG32 size);
+
+    // Invalidate any blocks overlapping the given range of target memory.
+    void Invalidate(TADDR addr, ULONG32 size);
+
+    void Flush(void);
+
+private:
+    // The block size trades round trips against wasted reads around unmapped
+    // regions; 64k keeps a linear heap walk at one target read per 64k of
+    // heap while still behaving reasonably on sparse address space.
+    static const ULONG32 BLOCK_SIZE = 64 * 1024;
+    // Up to 32MB of cached target memory; the data buffers are only allocated
+    // for blocks that are actually used.
+    static const ULONG32 NUM_BLOCKS = 512;
+
+    struct Block
+    {
+        // Block-aligned target address, 0 if the entry is unused.
+        TADDR base;
+        // Number of valid bytes starting at base. 0 records that the block
+        // could not be read from its start, so later misses within it don't
+        // retry the block fetch.
+        ULONG32 valid;
+        // BLOCK_SIZE bytes, allocated lazily and kept across flushes.
+        PBYTE data;
+    };
+
+    // Find the cache entry for the given block-aligned address, fetching the
+    // block contents from the target if the entry doesn't hold them already.
+    Block* GetBlock(TADDR base);
+
+    // The cache is direct-mapped so that the blocks of a linear walk land in
+    // consecutive entries and evict each other only after a full pass.
+    Block m_blocks[NUM_BLOCKS];
+};
+
 class DacInstanceManager
 {
 public:
@@ -1416,6 +1477,7 @@ public:
     TADDR m_globalBase;
     DacGlobals m_dacGlobals;
     DacInstanceManager m_instances;
+    DacTargetBlockCache m_blockCache;
     ULONG32 m_instanceAge;
     bool m_debugMode;
 
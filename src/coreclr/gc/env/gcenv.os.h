@@ -42,6 +42,10 @@ struct VirtualReserveFlags
     {
         None = 0,
         WriteWatch = 1,
+        // Hint the OS to back the reservation with huge pages once it is committed
+        // (e.g. transparent huge pages on Linux). Unlike VirtualReserveAndCommitLargePages
+        // this is best-effort and does not require a preallocated huge page pool.
+        HugePages = 2,
     };
 };
 
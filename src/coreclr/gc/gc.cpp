@@ -18,7 +18,13 @@
 
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -2326,6 +2332,10 @@ gc_history_global gc_heap::gc_data_global;
 
 uint64_t    gc_heap::gc_last_ephemeral_decommit_time = 0;
 
+size_t      gc_heap::decommit_memory_load_multiplier = 1;
+
+size_t      gc_heap::decommit_steps_since_load_check = 0;
+
 CLRCriticalSection gc_heap::check_commit_cs;
 
 #ifdef COMMITTED_BYTES_SHADOW
@@ -2504,6 +2514,10 @@ BOOL        gc_heap::last_gc_before_oom = FALSE;
 
 BOOL        gc_heap::sufficient_gen0_space_p = FALSE;
 
+#ifdef BACKGROUND_GC
+BOOL        gc_heap::bgc_high_frag_compact_p = FALSE;
+#endif //BACKGROUND_GC
+
 #ifdef BACKGROUND_GC
 uint8_t*    gc_heap::background_saved_lowest_address = 0;
 uint8_t*    gc_heap::background_saved_highest_address = 0;
@@ -5675,6 +5689,11 @@ void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node)
     }
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
+    if (GCConfig::GetGCTransparentHugePages())
+    {
+        flags |= VirtualReserveFlags::HugePages;
+    }
+
     void* prgmem = use_large_pages_p ?
         GCToOSInterface::VirtualReserveAndCommitLargePages(requested_size, numa_node) :
         GCToOSInterface::VirtualReserve(requested_size, card_size * card_word_width, flags, numa_node);
@@ -10361,6 +10380,27 @@ private:
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#ifdef TARGET_ARM64
+    // NEON doesn't downclock, so the threshold only needs to cover the
+    // fixed overhead of the vectorized sort
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 1024;
+
+    if (item_count <= 1)
+        return;
+
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf (3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1]);
+    }
+    else
+    {
+        dprintf (3, ("Sorting mark lists"));
+        introsort::sort (item_array, &item_array[item_count - 1], 0);
+    }
+    UNREFERENCED_PARAMETER(range_low);
+    UNREFERENCED_PARAMETER(range_high);
+#else //TARGET_ARM64
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const ptrdiff_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -10391,6 +10431,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
         dprintf (3, ("Sorting mark lists"));
         introsort::sort (item_array, &item_array[item_count - 1], 0);
     }
+#endif //TARGET_ARM64
 #ifdef _DEBUG
     // check the array is sorted
     for (ptrdiff_t i = 0; i < item_count - 1; i++)
@@ -11019,11 +11060,16 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    const bool use_vectorized_sort = IsSupportedInstructionSet (InstructionSet::NEON);
+#else //TARGET_ARM64
+    const bool use_vectorized_sort = IsSupportedInstructionSet (InstructionSet::AVX2);
+#endif //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = use_vectorized_sort ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = use_vectorized_sort ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -15166,6 +15212,10 @@ gc_heap::init_gc_heap (int h_number)
 
     sufficient_gen0_space_p = FALSE;
 
+#ifdef BACKGROUND_GC
+    bgc_high_frag_compact_p = FALSE;
+#endif //BACKGROUND_GC
+
 #ifdef MULTIPLE_HEAPS
 
 #ifdef HEAP_ANALYZE
@@ -17433,10 +17483,22 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
     int cookie = -1;
 #endif //BACKGROUND_GC
 
+    // On the pinned object heap we do a bounded best fit search within the bucket instead of
+    // taking the first fit. POH objects never move, so splitting a much larger free item than
+    // we need leaves behind fragmentation that no GC can undo; taking the tightest of the next
+    // several fits keeps long lived pinned buffers packed much more densely.
+    const int max_poh_fit_candidates = 16;
+
     for (unsigned int a_l_idx = allocator->first_suitable_bucket(size); a_l_idx < allocator->number_of_buckets(); a_l_idx++)
     {
         uint8_t* free_list = allocator->alloc_list_head_of (a_l_idx);
         uint8_t* prev_free_item = 0;
+
+        uint8_t* best_fit_item = 0;
+        uint8_t* best_fit_prev = 0;
+        size_t best_fit_size = 0;
+        int fit_candidates = 0;
+
         while (free_list != 0)
         {
             dprintf (3, ("considering free list %zx", (size_t)free_list));
@@ -17452,75 +17514,98 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
             // must fit exactly or leave formattable space
             if ((diff == 0) || (diff >= (ptrdiff_t)Align (min_obj_size, align_const)))
             {
+                if ((best_fit_item == 0) || (free_list_size < best_fit_size))
+                {
+                    best_fit_item = free_list;
+                    best_fit_prev = prev_free_item;
+                    best_fit_size = free_list_size;
+                }
+                fit_candidates++;
+
+                // for LOH the first fit wins outright; for POH keep looking for a tighter
+                // fit unless this one is exact or we have seen enough candidates
+                if ((gen_number != poh_generation) || (diff == 0) ||
+                    (fit_candidates >= max_poh_fit_candidates))
+                {
+                    break;
+                }
+            }
+            prev_free_item = free_list;
+            free_list = free_list_slot (free_list);
+        }
+
+        if (best_fit_item != 0)
+        {
+            free_list = best_fit_item;
+            prev_free_item = best_fit_prev;
+            size_t free_list_size = best_fit_size;
+
 #ifdef BACKGROUND_GC
 #ifdef MULTIPLE_HEAPS
-                assert (heap_of (free_list) == this);
+            assert (heap_of (free_list) == this);
 #endif // MULTIPLE_HEAPS
 
-                cookie = bgc_alloc_lock->uoh_alloc_set (free_list);
-                bgc_track_uoh_alloc();
+            cookie = bgc_alloc_lock->uoh_alloc_set (free_list);
+            bgc_track_uoh_alloc();
 #endif //BACKGROUND_GC
 
-                allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                remove_gen_free (gen_number, free_list_size);
+            allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+            remove_gen_free (gen_number, free_list_size);
 
-                // Subtract min obj size because limit_from_size adds it. Not needed for LOH
-                size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
-                dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
+            // Subtract min obj size because limit_from_size adds it. Not needed for LOH
+            size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
+                                            gen_number, align_const);
+            dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
-                size_t saved_free_list_size = free_list_size;
+            size_t saved_free_list_size = free_list_size;
 #ifdef FEATURE_LOH_COMPACTION
-                if (loh_pad)
-                {
-                    make_unused_array (free_list, loh_pad);
-                    generation_free_obj_space (gen) += loh_pad;
-                    limit -= loh_pad;
-                    free_list += loh_pad;
-                    free_list_size -= loh_pad;
-                }
+            if (loh_pad)
+            {
+                make_unused_array (free_list, loh_pad);
+                generation_free_obj_space (gen) += loh_pad;
+                limit -= loh_pad;
+                free_list += loh_pad;
+                free_list_size -= loh_pad;
+            }
 #endif //FEATURE_LOH_COMPACTION
 
-                uint8_t*  remain = (free_list + limit);
-                size_t remain_size = (free_list_size - limit);
-                if (remain_size != 0)
-                {
-                    assert (remain_size >= Align (min_obj_size, align_const));
-                    make_unused_array (remain, remain_size);
-                }
-                if (remain_size >= Align(min_free_list, align_const))
-                {
-                    uoh_thread_gap_front (remain, remain_size, gen);
-                    add_gen_free (gen_number, remain_size);
-                    assert (remain_size >= Align (min_obj_size, align_const));
-                }
-                else
-                {
-                    generation_free_obj_space (gen) += remain_size;
-                }
-                generation_free_list_space (gen) -= saved_free_list_size;
-                assert ((ptrdiff_t)generation_free_list_space (gen) >= 0);
-                generation_free_list_allocated (gen) += limit;
+            uint8_t*  remain = (free_list + limit);
+            size_t remain_size = (free_list_size - limit);
+            if (remain_size != 0)
+            {
+                assert (remain_size >= Align (min_obj_size, align_const));
+                make_unused_array (remain, remain_size);
+            }
+            if (remain_size >= Align(min_free_list, align_const))
+            {
+                uoh_thread_gap_front (remain, remain_size, gen);
+                add_gen_free (gen_number, remain_size);
+                assert (remain_size >= Align (min_obj_size, align_const));
+            }
+            else
+            {
+                generation_free_obj_space (gen) += remain_size;
+            }
+            generation_free_list_space (gen) -= saved_free_list_size;
+            assert ((ptrdiff_t)generation_free_list_space (gen) >= 0);
+            generation_free_list_allocated (gen) += limit;
 
-                dprintf (3, ("found fit on loh at %p", free_list));
+            dprintf (3, ("found fit on loh at %p", free_list));
 #ifdef BACKGROUND_GC
-                if (cookie != -1)
-                {
-                    bgc_uoh_alloc_clr (free_list, limit, acontext, flags, gen_number, align_const, cookie, FALSE, 0);
-                }
-                else
+            if (cookie != -1)
+            {
+                bgc_uoh_alloc_clr (free_list, limit, acontext, flags, gen_number, align_const, cookie, FALSE, 0);
+            }
+            else
 #endif //BACKGROUND_GC
-                {
-                    adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
-                }
-
-                //fix the limit to compensate for adjust_limit_clr making it too short
-                acontext->alloc_limit += Align (min_obj_size, align_const);
-                can_fit = TRUE;
-                goto exit;
+            {
+                adjust_limit_clr (free_list, limit, size, acontext, flags, 0, align_const, gen_number);
             }
-            prev_free_item = free_list;
-            free_list = free_list_slot (free_list);
+
+            //fix the limit to compensate for adjust_limit_clr making it too short
+            acontext->alloc_limit += Align (min_obj_size, align_const);
+            can_fit = TRUE;
+            goto exit;
         }
     }
 exit:
@@ -19091,6 +19176,13 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 gc_heap* new_home_hp = gc_heap::g_heaps[new_home_hp_num];
                 acontext->set_home_heap (new_home_hp->vm_heap);
 
+                // if the scheduler has moved this thread to a NUMA node different from the
+                // one its alloc heap lives on, every allocation it satisfies there is remote
+                // traffic - make the current heap easier to abandon so the thread migrates
+                // back to a heap on its new node.
+                bool org_hp_remote_node_p = (heap_select::find_numa_node_from_heap_no (org_hp_num) !=
+                                             heap_select::find_numa_node_from_heap_no (new_home_hp_num));
+
                 int start, end, finish;
                 heap_select::get_heap_range_for_heap (new_home_hp_num, &start, &end);
                 finish = start + n_heaps;
@@ -19099,7 +19191,7 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 {
                     max_hp = org_hp;
                     max_hp_num = org_hp_num;
-                    max_size = org_size + delta;
+                    max_size = org_hp_remote_node_p ? (org_size - delta) : (org_size + delta);
                     org_alloc_context_count = org_hp->alloc_context_count;
                     max_alloc_context_count = org_alloc_context_count;
                     if (org_hp == new_home_hp)
@@ -22462,7 +22554,17 @@ void gc_heap::gc1()
         //decide on the next allocation quantum
         if (alloc_contexts_used >= 1)
         {
-            allocation_quantum = Align (min ((size_t)CLR_SIZE,
+            // Each refill of an allocation context takes more_space_lock_soh, so the
+            // quantum is what spaces out lock acquisitions. When many threads share this
+            // heap, let the quantum grow past the base cap so each thread carves a bigger
+            // batch per lock acquisition; the budget-based bound below still keeps the
+            // total outstanding space (and thus gen0 waste at GC time) proportional.
+            size_t quantum_limit = (size_t)CLR_SIZE;
+            if (alloc_contexts_used > 8)
+            {
+                quantum_limit = min (quantum_limit * (alloc_contexts_used / 8), (size_t)(8 * CLR_SIZE));
+            }
+            allocation_quantum = Align (min (quantum_limit,
                                             (size_t)max ((size_t)1024, get_new_allocation (0) / (2 * alloc_contexts_used))),
                                             get_alignment_constant(FALSE));
             dprintf (3, ("New allocation quantum: %zd(0x%zx)", allocation_quantum, allocation_quantum));
@@ -26978,6 +27080,12 @@ uint8_t *mark_queue_t::queue_mark(uint8_t *o)
         return nullptr;
     }
     set_marked (old_o);
+#ifdef MARK_PHASE_PREFETCH
+    // the caller is about to interrogate the method table for the pointer map -
+    // its cache line is a dependent miss we can overlap with the caller's
+    // mark stack bookkeeping
+    Prefetch (method_table (old_o));
+#endif //MARK_PHASE_PREFETCH
     return old_o;
 }
 
@@ -27035,6 +27143,7 @@ uint8_t* mark_queue_t::get_next_marked()
             if (!already_marked)
             {
                 set_marked (o);
+                Prefetch (method_table (o));
                 curr_slot_index = slot_index;
                 return o;
             }
@@ -40790,6 +40899,41 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Find the first non-zero card word in [card_word, card_word_end).
+// Card tables on big heaps are mostly clean during ephemeral GCs, so this is hot -
+// scan 8 card words per step where a vector unit is available and let the caller
+// deal with the word that stopped the scan.
+static uint32_t* find_next_nonzero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(TARGET_AMD64)
+    for (; (card_word + 8) <= card_word_end; card_word += 8)
+    {
+        __m128i chunk = _mm_or_si128(
+            _mm_loadu_si128 ((const __m128i*)card_word),
+            _mm_loadu_si128 ((const __m128i*)card_word + 1));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (chunk, _mm_setzero_si128())) != 0xffff)
+        {
+            break;
+        }
+    }
+#elif defined(TARGET_ARM64)
+    for (; (card_word + 8) <= card_word_end; card_word += 8)
+    {
+        uint32x4_t chunk = vorrq_u32 (vld1q_u32 (card_word), vld1q_u32 (card_word + 4));
+        if (vmaxvq_u32 (chunk) != 0)
+        {
+            break;
+        }
+    }
+#endif
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -40824,10 +40968,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_next_nonzero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -40841,10 +40982,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_next_nonzero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -40864,15 +41002,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
-        while (card_word < card_word_end)
+        card_word = find_next_nonzero_card_word (card_word, card_word_end);
+        if (card_word < card_word_end)
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -43479,6 +43613,25 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                         new_allocation = min (new_allocation,
                                               max (min_gc_size, (max_size/3)));
                     }
+
+                    // If a pause target is configured, treat the gen0 budget as a feedback
+                    // control - ephemeral pause scales roughly with the allocation we let
+                    // accumulate, so when the previous ephemeral pause overshot the target,
+                    // shrink the next budget proportionally. Growing back when pauses are
+                    // under target is left to the normal survival-based computation above.
+                    uint64_t pause_target_us = (uint64_t)GCConfig::GetGCGen0PauseTarget() * 1000;
+                    if (pause_target_us != 0)
+                    {
+                        size_t last_ephemeral_pause_us = dd_gc_elapsed_time (dynamic_data_of (0));
+                        if (last_ephemeral_pause_us > pause_target_us)
+                        {
+                            size_t scaled_allocation = (size_t)((double)new_allocation *
+                                ((double)pause_target_us / (double)last_ephemeral_pause_us));
+                            dprintf (2, ("Reducing gen0 allocation for pause target: %zd us observed, %zd -> %zd",
+                                last_ephemeral_pause_us, new_allocation, scaled_allocation));
+                            new_allocation = max (min_gc_size, scaled_allocation);
+                        }
+                    }
                 }
             }
         }
@@ -44055,8 +44208,28 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
 
     size_t decommit_size = 0;
 
+    // Refresh the memory load reading about once per second of decommit stepping and
+    // scale the per-step budget by it. When the machine (or container - memory load is
+    // computed against the restricted limit if one is in effect) is under pressure we
+    // return dead committed memory several times faster; at normal load we keep the
+    // default gentle rate to limit recommit and page fault costs after the next spike.
+    if ((decommit_steps_since_load_check % (1000 / DECOMMIT_TIME_STEP_MILLISECONDS)) == 0)
+    {
+        uint32_t memory_load = 0;
+        get_memory_info (&memory_load);
+        if (memory_load >= v_high_memory_load_th)
+            decommit_memory_load_multiplier = 8;
+        else if (memory_load >= m_high_memory_load_th)
+            decommit_memory_load_multiplier = 4;
+        else if (memory_load >= high_memory_load_th)
+            decommit_memory_load_multiplier = 2;
+        else
+            decommit_memory_load_multiplier = 1;
+    }
+    decommit_steps_since_load_check++;
+
 #ifdef USE_REGIONS
-    const size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
+    const size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds * decommit_memory_load_multiplier;
     for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
     {
         dprintf (REGIONS_LOG, ("decommit_step %d, regions_to_decommit = %zd",
@@ -44219,8 +44392,9 @@ size_t gc_heap::decommit_ephemeral_segment_pages_step ()
                 // how much would we need to decommit to get to decommit_target in one step?
                 size_t full_decommit_size = (committed - decommit_target);
 
-                // don't do more than max_decommit_step_size per step
-                size_t decommit_size = min (max_decommit_step_size, full_decommit_size);
+                // don't do more than max_decommit_step_size per step, scaled up if
+                // memory load is high (see decommit_step)
+                size_t decommit_size = min (max_decommit_step_size * decommit_memory_load_multiplier, full_decommit_size);
 
                 // figure out where the new committed should be
                 uint8_t* new_committed = (committed - decommit_size);
@@ -44515,6 +44689,16 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
         get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_induced_compacting);
     }
 
+#ifdef BACKGROUND_GC
+    if ((condemned_gen_number == max_generation) && bgc_high_frag_compact_p && !settings.concurrent)
+    {
+        dprintf (GTC_LOG, ("h%d compacting because the last bgc measured high gen2 frag", heap_number));
+        should_compact = TRUE;
+        bgc_high_frag_compact_p = FALSE;
+        get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_high_frag);
+    }
+#endif //BACKGROUND_GC
+
     if (settings.reason == reason_induced_aggressive)
     {
         dprintf (2, ("aggressive compacting GC"));
@@ -46085,6 +46269,22 @@ void gc_heap::background_sweep()
         generation_free_list_space (generation_of (max_generation)),
         generation_free_obj_space (generation_of (max_generation))));
 
+    // Background GC never compacts, so gen2 fragmentation it leaves behind is only paid
+    // back by a blocking full GC. If configured, remember that this cycle measured high
+    // fragmentation so the next blocking full GC chooses to compact.
+    int bgc_compact_frag_ratio = (int)GCConfig::GetGCBGCCompactFragRatio();
+    if ((bgc_compact_frag_ratio > 0) && (total_soh_size != 0))
+    {
+        size_t gen2_frag = generation_free_list_space (generation_of (max_generation)) +
+                           generation_free_obj_space (generation_of (max_generation));
+        if ((gen2_frag * 100) >= (total_soh_size * (size_t)bgc_compact_frag_ratio))
+        {
+            dprintf (GTC_LOG, ("h%d: bgc measured gen2 frag %zd/%zd >= %d%%, requesting compaction",
+                heap_number, gen2_frag, total_soh_size, bgc_compact_frag_ratio));
+            bgc_high_frag_compact_p = TRUE;
+        }
+    }
+
     dprintf (GTC_LOG, ("h%d: end of bgc sweep: loh FL: %zd, FO: %zd",
         heap_number,
         generation_free_list_space (generation_of (loh_generation)),
@@ -48395,7 +48595,19 @@ HRESULT GCHeap::Initialize()
     GCConfig::SetHeapCount(static_cast<int64_t>(nhp));
 
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
+#ifdef FEATURE_64BIT_ALIGNMENT
+    // Biased (boxed value type) object headers are not supported on the LOH; the
+    // assumption that boxed value types can never reach the threshold only holds
+    // while it stays above 64KB, so the threshold cannot be lowered here.
     loh_size_threshold = max (loh_size_threshold, LARGE_OBJECT_SIZE);
+#else
+    // The threshold may be lowered so that moderately sized buffers (for example
+    // 32KB-84KB network buffers) are placed directly on the LOH, which is rarely
+    // compacted, instead of being copied through the ephemeral generations. Below
+    // 32KB the loss of locality and the per-object LOH costs outweigh the copy
+    // savings, so that is the floor.
+    loh_size_threshold = max (loh_size_threshold, MIN_LOH_SIZE_THRESHOLD);
+#endif //FEATURE_64BIT_ALIGNMENT
 
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
@@ -49457,7 +49669,11 @@ GCHeap::Alloc(gc_alloc_context* context, size_t size, uint32_t flags REQD_ALIGN_
         // we've managed to arrange things so the only case where we see a bias is for boxed value types and
         // these can never get large enough to be allocated on the LOH.
         ASSERT((flags & GC_ALLOC_ALIGN8_BIAS) == 0);
+#ifdef FEATURE_64BIT_ALIGNMENT
+        // only platforms with biased headers need the threshold to stay above the
+        // largest possible boxed value type - see the clamp in Initialize
         ASSERT(65536 < loh_size_threshold);
+#endif //FEATURE_64BIT_ALIGNMENT
 
         int gen_num = (flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? poh_generation : loh_generation;
         newAlloc = (Object*) hp->allocate_uoh_object (size + ComputeMaxStructAlignPadLarge(requiredAlignment), flags, gen_num, acontext->alloc_bytes_uoh);
@@ -51200,21 +51416,47 @@ Object* GCHeap::GetNextFinalizableObject()
 
 #ifdef MULTIPLE_HEAPS
 
+    // A burst of finalizable objects tends to land on a handful of heaps, and
+    // restarting the search at heap 0 for every dequeue pays a lock probe on each
+    // empty queue in front of them. Remember the heap that last produced an object
+    // and resume there, so draining a burst costs O(1) probes per object instead
+    // of O(n_heaps). The hint is racy on purpose - a stale value just means a few
+    // extra probes.
+    static VOLATILE(int) last_heap_hint = 0;
+    int hint = last_heap_hint;
+    if ((hint < 0) || (hint >= gc_heap::n_heaps))
+    {
+        // n_heaps can shrink when the heap count is adjusted dynamically
+        hint = 0;
+    }
+
     //return the first non critical one in the first queue.
-    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    for (int idx = 0; idx < gc_heap::n_heaps; idx++)
     {
+        int hn = hint + idx;
+        if (hn >= gc_heap::n_heaps)
+            hn -= gc_heap::n_heaps;
         gc_heap* hp = gc_heap::g_heaps [hn];
         Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
         if (O)
+        {
+            last_heap_hint = hn;
             return O;
+        }
     }
     //return the first non critical/critical one in the first queue.
-    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    for (int idx = 0; idx < gc_heap::n_heaps; idx++)
     {
+        int hn = hint + idx;
+        if (hn >= gc_heap::n_heaps)
+            hn -= gc_heap::n_heaps;
         gc_heap* hp = gc_heap::g_heaps [hn];
         Object* O = hp->finalize_queue->GetNextFinalizableObject(FALSE);
         if (O)
+        {
+            last_heap_hint = hn;
             return O;
+        }
     }
     return 0;
 
@@ -104,6 +104,11 @@ class IGCHeapInternal;
 /* misc defines */
 #define LARGE_OBJECT_SIZE ((size_t)(85000))
 
+// The LOH threshold can be lowered via the GCLOHThreshold config down to this floor,
+// so that moderately sized buffers are placed directly on the LOH instead of being
+// copied through the ephemeral generations.
+#define MIN_LOH_SIZE_THRESHOLD ((size_t)(32*1024))
+
 enum gc_generation_num
 {
     // small object heap includes generations [0-2], which are "generations" in the general sense.
@@ -219,6 +219,11 @@ struct segment_info
 
 #define LARGE_OBJECT_SIZE ((size_t)(85000))
 
+// The LOH threshold can be lowered via the GCLOHThreshold config down to this floor,
+// so that moderately sized buffers are placed directly on the LOH instead of being
+// copied through the ephemeral generations.
+#define MIN_LOH_SIZE_THRESHOLD ((size_t)(32*1024))
+
 // The minimum size of an object is three pointers wide: one for the syncblock,
 // one for the object header, and one for the first field in the object.
 #define min_obj_size ((sizeof(uint8_t*) + sizeof(uintptr_t) + sizeof(size_t)))
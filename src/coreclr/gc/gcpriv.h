@@ -3658,6 +3658,12 @@ private:
     // set by the allocator/GC and cleared during a full blocking GC
     PER_HEAP_FIELD_SINGLE_GC_ALLOC BOOL last_gc_before_oom;
 
+#ifdef BACKGROUND_GC
+    // set at the end of a background GC when the gen2 fragmentation it measured
+    // exceeds GCBGCCompactFragRatio; makes the next blocking full GC compact
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC BOOL bgc_high_frag_compact_p;
+#endif //BACKGROUND_GC
+
 #ifdef MULTIPLE_HEAPS
     PER_HEAP_FIELD_SINGLE_GC_ALLOC VOLATILE(int) alloc_context_count;
 
@@ -4209,6 +4215,12 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t gc_last_ephemeral_decommit_time;
 
+    // Multiplier applied to the per-step decommit budget. Raised when physical memory
+    // load is high so dead committed memory is returned to the OS sooner; 1 at normal
+    // load so we keep the gentle default rate. Refreshed periodically by decommit_step.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t decommit_memory_load_multiplier;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t decommit_steps_since_load_check;
+
     // maintained as we need to grow bookkeeping data.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t card_table_element_layout[total_bookkeeping_elements + 1];
 
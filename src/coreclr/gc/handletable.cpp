@@ -662,6 +662,8 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
     info.pfnScan         = pfnEnum;
     info.param1          = lParam1;
     info.param2          = lParam2;
+    info.uSegmentStart   = 0;
+    info.uSegmentStep    = 1;
 
     // choose a scanning method based on the async flag
     TABLESCANPROC pfnScanTable = TableScanHandles;
@@ -771,6 +773,26 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
     info.pfnScan         = scanProc;
     info.param1          = param1;
     info.param2          = param2;
+    info.uSegmentStart   = 0;
+    info.uSegmentStep    = 1;
+
+#ifndef DACCESS_COMPILE
+    if (flags & HNDGCF_STRIDED)
+    {
+        // GC-time callers pass the ScanContext as param1 (see objecthandle.cpp);
+        // a strided scan splits the segments of this table across the scan threads.
+        // Stagger each table's starting phase by a value derived from the table's
+        // identity: every scan thread computes the same stagger for a given table,
+        // so each segment is still scanned by exactly one thread, but the first
+        // segment of successive tables falls to different threads. Without the
+        // stagger, segment 0 of every table - and with it the whole of every
+        // single-segment table, the common case - would land on scan thread 0.
+        ScanContext* sc = (ScanContext*)param1;
+        uint32_t uStagger = (uint32_t)((((uintptr_t)pTable >> 6) + pTable->uTableIndex) % (uint32_t)sc->thread_count);
+        info.uSegmentStart = ((uint32_t)sc->thread_number + uStagger) % (uint32_t)sc->thread_count;
+        info.uSegmentStep  = (uint32_t)sc->thread_count;
+    }
+#endif
 
 #if defined(_DEBUG) && !defined(DACCESS_COMPILE)
     info.DEBUG_BlocksScanned                = 0;
@@ -833,6 +855,8 @@ void HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.pfnScan         = NULL;
     info.param1          = 0;
     info.param2          = 0;
+    info.uSegmentStart   = 0;
+    info.uSegmentStep    = 1;
 
     {
         // lock the table down
@@ -873,6 +897,8 @@ void HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCou
     info.pfnScan         = NULL;
     info.param1          = 0;
     info.param2          = 0;
+    info.uSegmentStart   = 0;
+    info.uSegmentStep    = 1;
 
     {
         // lock the table down
@@ -962,9 +988,9 @@ uint32_t HndCountHandles(HHANDLETABLE hTable)
     }
 
     // it is not necessary to have the lock while reading the quick cache;
-    // loop through the quick cache for each handle type
-    OBJECTHANDLE * pQuickCache = pTable->rgQuickCache;
-    OBJECTHANDLE * pQuickCacheEnd = pQuickCache + HANDLE_MAX_INTERNAL_TYPES;
+    // loop through every slot of the quick cache for each handle type
+    OBJECTHANDLE * pQuickCache = &pTable->rgQuickCache[0][0];
+    OBJECTHANDLE * pQuickCacheEnd = pQuickCache + (HANDLE_QUICK_CACHE_DEPTH * HANDLE_MAX_INTERNAL_TYPES);
     for (; pQuickCache != pQuickCacheEnd; ++pQuickCache)
         if (*pQuickCache)
             ++uCacheCount;
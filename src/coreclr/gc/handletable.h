@@ -111,6 +111,7 @@ void HndEnumHandles(HHANDLETABLE hTable, const uint32_t *puType, uint32_t uTypeC
 #define HNDGCF_AGE          (0x00000001)    // age handles while scanning
 #define HNDGCF_ASYNC        (0x00000002)    // drop the table lock while scanning
 #define HNDGCF_EXTRAINFO    (0x00000004)    // iterate per-handle data while scanning
+#define HNDGCF_STRIDED      (0x00000008)    // split the segments of the table across the GC scan threads
 
 GC_DAC_VISIBLE_NO_MANGLE
 void            HndScanHandlesForGC(HHANDLETABLE hTable,
@@ -719,14 +719,18 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
     OBJECTHANDLE handle;
 
     // first try to get a handle from the quick cache
-    if (pTable->rgQuickCache[uType])
+    for (uint32_t uDepth = 0; uDepth < HANDLE_QUICK_CACHE_DEPTH; uDepth++)
     {
-        // try to grab the handle we saw
-        handle = Interlocked::ExchangePointer(pTable->rgQuickCache + uType, (OBJECTHANDLE)NULL);
+        // any handle visible at this depth?
+        if (pTable->rgQuickCache[uDepth][uType])
+        {
+            // try to grab the handle we saw
+            handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uDepth][uType], (OBJECTHANDLE)NULL);
 
-        // if it worked then we're done
-        if (handle)
-            return handle;
+            // if it worked then we're done
+            if (handle)
+                return handle;
+        }
     }
 
     // ok, get the main handle cache for this type
@@ -787,14 +791,18 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
         HandleQuickSetUserData(handle, 0L);
 
     // is there room in the quick cache?
-    if (!pTable->rgQuickCache[uType])
+    for (uint32_t uDepth = 0; uDepth < HANDLE_QUICK_CACHE_DEPTH; uDepth++)
     {
-        // yup - try to stuff our handle in the slot we saw
-        handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType], handle);
+        // does this depth look empty?
+        if (!pTable->rgQuickCache[uDepth][uType])
+        {
+            // yup - try to stuff our handle in the slot we saw
+            handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uDepth][uType], handle);
 
-        // if we didn't end up with another handle then we're done
-        if (!handle)
-            return;
+            // if we didn't end up with another handle then we're done
+            if (!handle)
+                return;
+        }
     }
 
     // ok, get the main handle cache for this type
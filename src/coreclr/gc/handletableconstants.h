@@ -101,6 +101,10 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 #define HANDLE_CACHE_TYPE_SIZE          128 // 128 == 63 handles per bank
 #define HANDLES_PER_CACHE_BANK          ((HANDLE_CACHE_TYPE_SIZE / 2) - 1)
 
+// number of interlocked 'quick' cache slots per handle type; deep enough that bursty
+// create/destroy traffic stays out of the main cache banks and their miss paths
+#define HANDLE_QUICK_CACHE_DEPTH        8
+
 // cache policy defines
 #define REBALANCE_TOLERANCE             (HANDLES_PER_CACHE_BANK / 3)
 #define REBALANCE_LOWATER_MARK          (HANDLES_PER_CACHE_BANK - REBALANCE_TOLERANCE)
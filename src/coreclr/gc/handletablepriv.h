@@ -263,6 +263,8 @@ struct ScanCallbackInfo
     uintptr_t        param1;            // callback param 1
     uintptr_t        param2;            // callback param 2
     uint32_t         dwAgeMask;         // generation mask for ephemeral GCs
+    uint32_t         uSegmentStart;     // ordinal of the first segment this thread scans (HNDGCF_STRIDED)
+    uint32_t         uSegmentStep;      // segment stride for this scan; 1 scans every segment
 
 #ifdef _DEBUG
     uint32_t DEBUG_BlocksScanned;
@@ -409,9 +411,12 @@ struct HandleTable
     uint32_t uTableIndex;
 
     /*
-     * one-level per-type 'quick' handle cache
+     * shallow per-type 'quick' handle cache
+     *
+     * N.B. the depth is the major dimension so that concurrent callers probing at
+     * different depths for the same type operate on different cache lines
      */
-    OBJECTHANDLE rgQuickCache[HANDLE_MAX_INTERNAL_TYPES];   // interlocked ops used here
+    OBJECTHANDLE rgQuickCache[HANDLE_QUICK_CACHE_DEPTH][HANDLE_MAX_INTERNAL_TYPES];   // interlocked ops used here
 
     /*
      * debug-only statistics
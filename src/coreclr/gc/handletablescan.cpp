@@ -1725,9 +1725,16 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
         BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
 
     // now, iterate over the segments, scanning blocks of the specified type(s)
+    uint32_t uSegmentOrdinal = 0;
     PTR_TableSegment pSegment = NULL;
     while ((pSegment = pfnSegmentIterator(pTable, pSegment, pCrstHolder)) != NULL)
     {
+        // in a strided scan (HNDGCF_STRIDED) each scan thread only processes its
+        // share of the segments; the rest belong to the other scan threads
+        uint32_t uOrdinal = uSegmentOrdinal++;
+        if ((pInfo->uSegmentStep > 1) && ((uOrdinal % pInfo->uSegmentStep) != pInfo->uSegmentStart))
+            continue;
+
         // if there are types to scan then enumerate the blocks in this segment
         // (we do this test inside the loop since the iterators should still run...)
         if (uTypeCount >= 1)
@@ -880,6 +880,26 @@ int getThreadCount(ScanContext* sc)
     return sc->thread_count;
 }
 
+// Handle affinity concentrates handles in the per-processor tables of the
+// threads that created them, so fanning a multi-threaded blocking scan out
+// over whole tables can leave most of the work on one scan thread. For such
+// scans every thread instead visits every table and strides over the segments
+// within each table (see HNDGCF_STRIDED), balancing the work at segment
+// granularity. Asynchronous (concurrent) scans keep the table-granularity
+// fan-out since they queue blocks for later processing.
+static bool StrideScanOverSegments(ScanContext* sc, uint32_t& flags, int& uCPUindex, int& uCPUstep)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if ((flags & HNDGCF_ASYNC) || (getThreadCount(sc) <= 1))
+        return false;
+
+    uCPUindex = 0;
+    uCPUstep = 1;
+    flags |= HNDGCF_STRIDED;
+    return true;
+}
+
 void SetDependentHandleSecondary(OBJECTHANDLE handle, OBJECTREF objref)
 {
     CONTRACTL
@@ -996,6 +1016,7 @@ void TraceVariableHandles(HANDLESCANPROC pfnTrace, ScanContext *sc, uintptr_t lp
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1069,6 +1090,7 @@ void Ref_TracePinningRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1116,6 +1138,7 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1150,6 +1173,7 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
                     int uCPUlimit = getNumberOfSlots();
                     assert(uCPUlimit > 0);
                     int uCPUstep = getThreadCount(sc);
+                    StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                     HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                     for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                     {
@@ -1227,6 +1251,7 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1317,6 +1342,7 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
                     int uCPUlimit = getNumberOfSlots();
                     assert(uCPUlimit > 0);
                     int uCPUstep = getThreadCount(pDhContext->m_pScanContext);
+                    StrideScanOverSegments(pDhContext->m_pScanContext, flags, uCPUindex, uCPUstep);
                     HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                     for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                     {
@@ -1366,6 +1392,7 @@ void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, Sc
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1400,6 +1427,7 @@ void Ref_ScanWeakInteriorPointersForRelocation(uint32_t condemned, uint32_t maxg
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1434,6 +1462,7 @@ void Ref_ScanDependentHandlesForRelocation(uint32_t condemned, uint32_t maxgen,
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1547,6 +1576,7 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1617,6 +1647,7 @@ void Ref_UpdatePointers(uint32_t condemned, uint32_t maxgen, ScanContext* sc, Re
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
@@ -1743,6 +1774,7 @@ void Ref_UpdatePinnedPointers(uint32_t condemned, uint32_t maxgen, ScanContext*
                 int uCPUlimit = getNumberOfSlots();
                 assert(uCPUlimit > 0);
                 int uCPUstep = getThreadCount(sc);
+                StrideScanOverSegments(sc, flags, uCPUindex, uCPUstep);
                 HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
                 for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
                 {
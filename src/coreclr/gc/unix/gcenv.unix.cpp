@@ -606,6 +606,15 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
         {
             madvise(pRetVal, size, MADV_DONTDUMP);
         }
+#endif
+#ifdef MADV_HUGEPAGE
+        if (flags & VirtualReserveFlags::HugePages)
+        {
+            // Steer the kernel towards backing this range with transparent huge pages
+            // once it gets committed. This is only a hint and can fail, e.g. when THP
+            // is disabled on the system; the reservation is fine either way.
+            madvise(pRetVal, size, MADV_HUGEPAGE);
+        }
 #endif
         return pRetVal;
     }
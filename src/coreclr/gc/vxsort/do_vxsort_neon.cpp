@@ -0,0 +1,267 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#if defined(TARGET_ARM64)
+
+#include <arm_neon.h>
+
+#include "do_vxsort.h"
+
+// This is a NEON analog of the AVX2/AVX512 vxsort kernels, used to sort the
+// mark list on ARM64. It follows the double-pumped partitioning scheme of
+// vxsort.h, specialized to two 64-bit lanes per vector: NEON has no
+// compressed store, but with only two lanes the in-register partition
+// permutation degenerates into a single conditional lane rotation.
+//
+// Unlike the AVX2 kernel we do not attempt packing (machine_traits.avx2.h):
+// halving the element width only takes us from two lanes to four on 128-bit
+// NEON, and the extra pack/unpack passes do not pay for themselves there.
+
+namespace
+{
+
+const ptrdiff_t N = 2; // 64-bit elements per 128-bit vector
+
+// below this many elements we use a simple scalar insertion sort, analogous
+// to (if less sophisticated than) the bitonic small-sort of the x64 kernels
+const ptrdiff_t SMALL_SORT_THRESHOLD_ELEMENTS = 32;
+
+// temporary space used for the vectors and the scalar remainder partitioned
+// out of the way before the main loop; sized generously - we stash at most
+// 2*N elements plus one remainder element, and the full-width stores need
+// N elements of headroom on each side
+const ptrdiff_t PARTITION_TMP_SIZE_IN_ELEMENTS = 16;
+
+class neon_sorter
+{
+    int64_t _temp[PARTITION_TMP_SIZE_IN_ELEMENTS];
+
+    static void swap (int64_t* left, int64_t* right)
+    {
+        int64_t tmp = *left;
+        *left = *right;
+        *right = tmp;
+    }
+
+    static void swap_if_greater (int64_t* left, int64_t* right)
+    {
+        if (*left <= *right)
+            return;
+        swap (left, right);
+    }
+
+    static void insertion_sort (int64_t* lo, int64_t* hi)
+    {
+        for (int64_t* i = lo + 1; i <= hi; i++)
+        {
+            int64_t t = *i;
+            int64_t* j = i;
+            while ((j > lo) && (*(j - 1) > t))
+            {
+                *j = *(j - 1);
+                j--;
+            }
+            *j = t;
+        }
+    }
+
+    static void heap_sort (int64_t* lo, int64_t* hi)
+    {
+        size_t n = hi - lo + 1;
+        for (size_t i = n / 2; i >= 1; i--)
+        {
+            down_heap (i, n, lo);
+        }
+        for (size_t i = n; i > 1; i--)
+        {
+            swap (lo, lo + i - 1);
+            down_heap (1, i - 1, lo);
+        }
+    }
+
+    static void down_heap (size_t i, size_t n, int64_t* lo)
+    {
+        int64_t d = *(lo + i - 1);
+        size_t child;
+        while (i <= n / 2)
+        {
+            child = 2 * i;
+            if ((child < n) && (*(lo + child - 1) < *(lo + child)))
+            {
+                child++;
+            }
+            if (!(d < *(lo + child - 1)))
+            {
+                break;
+            }
+            *(lo + i - 1) = *(lo + child - 1);
+            i = child;
+        }
+        *(lo + i - 1) = d;
+    }
+
+    static int floor_log2_plus_one (size_t n)
+    {
+        int result = 0;
+        while (n >= 1)
+        {
+            result++;
+            n /= 2;
+        }
+        return result;
+    }
+
+    // Partition one vector against the pivot, writing the full vector to both
+    // write heads with the <= pivot lanes first, then advancing each head by
+    // the respective lane count - this is partition_block_without_compress
+    // from vxsort.h with the two-lane permutation done via a lane rotation.
+    static inline void partition_block (int64x2_t data, int64x2_t P, int64_t*& write_left, int64_t*& write_right)
+    {
+        uint64x2_t gt = vcgtq_s64 (data, P);
+        int mask = (int)(vgetq_lane_u64 (gt, 0) & 1) | (int)(vgetq_lane_u64 (gt, 1) & 2);
+
+        // the only lane order that needs fixing is (>, <=), i.e. mask == 1
+        if (mask == 1)
+        {
+            data = vextq_s64 (data, data, 1);
+        }
+        vst1q_s64 (write_left, data);
+        vst1q_s64 (write_right, data);
+
+        int gt_count = (mask & 1) + (mask >> 1);
+        write_left += N - gt_count;
+        write_right -= gt_count;
+    }
+
+    // Partition [left, right) around the pivot stored at *right, returning a
+    // pointer one past the pivot's final position. This is the Unroll=1 shape
+    // of vxsort.h's vectorized_partition, minus the cache-line alignment pass.
+    int64_t* vectorized_partition (int64_t* left, int64_t* right)
+    {
+        assert ((right - left) >= SMALL_SORT_THRESHOLD_ELEMENTS);
+
+        int64_t pivot = *right;
+        const int64x2_t P = vdupq_n_s64 (pivot);
+
+        int64_t* read_left = left;
+        int64_t* read_right = right;
+
+        int64_t* tmp_left = _temp;
+        int64_t* tmp_right = _temp + PARTITION_TMP_SIZE_IN_ELEMENTS - N;
+
+        // stash one vector from each end in the temp area to open up enough
+        // space so the main loop can always write a full vector to the side
+        // it just read from
+        int64x2_t dl = vld1q_s64 (read_left);
+        int64x2_t dr = vld1q_s64 (read_right - N);
+        partition_block (dl, P, tmp_left, tmp_right);
+        partition_block (dr, P, tmp_left, tmp_right);
+        tmp_right += N;
+        read_left += N;
+        read_right -= 2 * N;
+
+        // partition the scalar remainder into the temp area as well so the
+        // main loop only ever deals with whole vectors
+        ptrdiff_t remainder = (read_right + N - read_left) % N;
+        while (remainder-- > 0)
+        {
+            read_right--;
+            int64_t val = read_right[N];
+            if (val > pivot)
+            {
+                *(--tmp_right) = val;
+            }
+            else
+            {
+                *tmp_left++ = val;
+            }
+        }
+
+        int64_t* write_left = left;
+        int64_t* write_right = right - N;
+
+        // read_right points at the base of the last unread vector; pick the
+        // side whose write head is closest to overrunning its read head
+        while (read_left <= read_right)
+        {
+            int64_t* next;
+            if ((write_right - read_right) < N)
+            {
+                next = read_right;
+                read_right -= N;
+            }
+            else
+            {
+                next = read_left;
+                read_left += N;
+            }
+
+            int64x2_t d = vld1q_s64 (next);
+            partition_block (d, P, write_left, write_right);
+        }
+
+        // copy back what we stashed in the temp area - it fits exactly in the
+        // gap left between the two write heads
+        size_t left_tmp_count = tmp_left - _temp;
+        memcpy (write_left, _temp, left_tmp_count * sizeof(int64_t));
+        write_left += left_tmp_count;
+        size_t right_tmp_count = (_temp + PARTITION_TMP_SIZE_IN_ELEMENTS) - tmp_right;
+        memcpy (write_left, tmp_right, right_tmp_count * sizeof(int64_t));
+
+        // shove the pivot back to the boundary
+        *right = *write_left;
+        *write_left++ = pivot;
+
+        assert (write_left > left);
+        assert (write_left <= right + 1);
+
+        return write_left;
+    }
+
+public:
+    void sort (int64_t* lo, int64_t* hi, int depth_limit)
+    {
+        ptrdiff_t length = hi - lo + 1;
+        if (length <= SMALL_SORT_THRESHOLD_ELEMENTS)
+        {
+            insertion_sort (lo, hi);
+            return;
+        }
+
+        if (depth_limit == 0)
+        {
+            heap_sort (lo, hi);
+            return;
+        }
+
+        // median-of-three of the first, mid and last elements, placed at the
+        // right hand side like vxsort.h does
+        int64_t* mid = lo + (length / 2);
+        swap_if_greater (lo, mid);
+        swap_if_greater (lo, hi);
+        swap_if_greater (mid, hi);
+        swap (mid, hi);
+
+        int64_t* sep = vectorized_partition (lo, hi);
+
+        sort (lo, sep - 2, depth_limit - 1);
+        sort (sep, hi, depth_limit - 1);
+    }
+
+    void sort (int64_t* lo, int64_t* hi)
+    {
+        sort (lo, hi, 2 * floor_log2_plus_one (hi - lo + 1));
+    }
+};
+
+} // anonymous namespace
+
+void do_vxsort_neon (uint8_t** low, uint8_t** high)
+{
+    neon_sorter sorter;
+    sorter.sort ((int64_t*)low, (int64_t*)high);
+}
+
+#endif // TARGET_ARM64
@@ -14,7 +14,8 @@ enum class SupportedISA
 {
     None = 0,
     AVX2 = 1 << (int)InstructionSet::AVX2,
-    AVX512F = 1 << (int)InstructionSet::AVX512F
+    AVX512F = 1 << (int)InstructionSet::AVX512F,
+    NEON = 1 << (int)InstructionSet::NEON
 };
 
 #if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
@@ -80,7 +81,7 @@ SupportedISA DetermineSupportedISA()
     return SupportedISA::None;
 }
 
-#elif defined(TARGET_UNIX)
+#elif defined(TARGET_AMD64) && defined(TARGET_UNIX)
 
 SupportedISA DetermineSupportedISA()
 {
@@ -98,7 +99,15 @@ SupportedISA DetermineSupportedISA()
     }
 }
 
-#endif // defined(TARGET_UNIX)
+#elif defined(TARGET_ARM64)
+
+SupportedISA DetermineSupportedISA()
+{
+    // NEON is part of the baseline ARM64 ISA
+    return SupportedISA::NEON;
+}
+
+#endif // defined(TARGET_ARM64)
 
 static bool s_initialized;
 static SupportedISA s_supportedISA;
@@ -106,16 +115,18 @@ static SupportedISA s_supportedISA;
 bool IsSupportedInstructionSet (InstructionSet instructionSet)
 {
     assert(s_initialized);
-    assert(instructionSet == InstructionSet::AVX2 || instructionSet == InstructionSet::AVX512F);
+    assert(instructionSet == InstructionSet::AVX2 || instructionSet == InstructionSet::AVX512F || instructionSet == InstructionSet::NEON);
     return ((int)s_supportedISA & (1 << (int)instructionSet)) != 0;
 }
 
 void InitSupportedInstructionSet (int32_t configSetting)
 {
     s_supportedISA = (SupportedISA)((int)DetermineSupportedISA() & configSetting);
+#if defined(TARGET_AMD64)
     // we are assuming that AVX2 can be used if AVX512F can,
     // so if AVX2 is disabled, we need to disable AVX512F as well
     if (!((int)s_supportedISA & (int)SupportedISA::AVX2))
         s_supportedISA = SupportedISA::None;
+#endif
     s_initialized = true;
 }
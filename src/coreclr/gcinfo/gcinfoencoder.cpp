@@ -2643,7 +2643,6 @@ void BitStreamWriter::Write( size_t data, UINT32 count )
 
 void BitStreamWriter::CopyTo( BYTE* buffer )
 {
-    int i,c;
     BYTE* source = NULL;
 
     MemoryBlock* pMemBlock = m_MemoryBlocks.Head();
@@ -2652,26 +2651,17 @@ void BitStreamWriter::CopyTo( BYTE* buffer )
 
     while (pMemBlock->Next() != NULL)
     {
-        source = (BYTE*) pMemBlock->Contents;
-        // @TODO: use memcpy instead
-        for( i = 0; i < m_MemoryBlockSize; i++ )
-        {
-            *( buffer++ ) = *( source++ );
-        }
+        memcpy( buffer, pMemBlock->Contents, m_MemoryBlockSize );
+        buffer += m_MemoryBlockSize;
 
         pMemBlock = pMemBlock->Next();
     }
 
     source = (BYTE*) pMemBlock->Contents;
     // The number of bytes to copy in the last block
-    c = (int) ((BYTE*) ( m_pCurrentSlot + 1 ) - source - m_FreeBitsInCurrentSlot/8);
+    int c = (int) ((BYTE*) ( m_pCurrentSlot + 1 ) - source - m_FreeBitsInCurrentSlot/8);
     _ASSERTE( c >= 0 );
-    // @TODO: use memcpy instead
-    for( i = 0; i < c; i++ )
-    {
-        *( buffer++ ) = *( source++ );
-    }
-
+    memcpy( buffer, source, c );
 }
 
 void BitStreamWriter::Dispose()
@@ -2706,13 +2696,35 @@ int BitStreamWriter::EncodeVarLengthUnsigned( size_t n, UINT32 base)
     _ASSERTE(((INT32)(UINT32)n) >= 0);
     _ASSERTE((base > 0) && (base < BITS_PER_SIZE_T));
     size_t numEncodings = size_t{ 1 } << base;
-    int bitsUsed;
-    for(bitsUsed = base+1; ; bitsUsed += base+1)
+
+    // Fast path: pack all the chunks into a single slot-sized write. Most
+    // encodings are only one or two chunks, so this avoids paying Write's
+    // bookkeeping once per chunk.
+    size_t encoding  = 0;
+    UINT32 bitsUsed  = 0;
+    size_t remainder = n;
+    while( bitsUsed + base + 1 <= BITS_PER_SIZE_T )
+    {
+        if( remainder < numEncodings )
+        {
+            encoding |= remainder << bitsUsed; // This sets the extension bit to zero
+            Write( encoding, bitsUsed + base + 1 );
+            return bitsUsed + base + 1;
+        }
+
+        encoding |= ((remainder & (numEncodings-1)) | numEncodings) << bitsUsed;
+        remainder >>= base;
+        bitsUsed += base + 1;
+    }
+
+    // Slow path: the encoding is longer than one slot, so write it out chunk by chunk
+    int totalBitsUsed;
+    for(totalBitsUsed = base+1; ; totalBitsUsed += base+1)
     {
         if( n < numEncodings )
         {
             Write( n, base+1 ); // This sets the extension bit to zero
-            return bitsUsed;
+            return totalBitsUsed;
         }
         else
         {
@@ -2721,7 +2733,7 @@ int BitStreamWriter::EncodeVarLengthUnsigned( size_t n, UINT32 base)
             n >>= base;
         }
     }
-    return bitsUsed;
+    return totalBitsUsed;
 }
 
 int BitStreamWriter::EncodeVarLengthSigned( SSIZE_T n, UINT32 base )
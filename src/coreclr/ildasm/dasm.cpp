@@ -7363,6 +7363,9 @@ FILE* OpenOutput(_In_ __nullterminated const WCHAR* wzFileName)
 
     if(pfile)
     {
+        // Disassembly is emitted one line at a time; a large stream buffer keeps
+        // big dumps from paying a write syscall every few lines.
+        setvbuf(pfile,NULL,_IOFBF,1024*1024);
         if(g_uCodePage == CP_UTF8) fwrite("\357\273\277",3,1,pfile);
         else if(g_uCodePage == 0xFFFFFFFF) fwrite("\377\376",2,1,pfile);
     }
@@ -117,19 +117,20 @@ private:
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-// Uncomment these to gather information to better choose caching parameters
-//#define VARIABLE_SIZED_CACHEDMAPPING_SIZE
-
-    // Last RW mappings cached so that it can be reused for the next mapping
-    // request if it goes into the same range.
-    // This is handled as a 3 element cache with an LRU replacement policy
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    // If variable sized mappings enabled, make the cache physically big enough to cover all interesting sizes
+    // Last RW mappings cached so that they can be reused for the next mapping
+    // requests if they go into the same ranges.
+    // This is handled as a cache with an LRU replacement policy. The number of
+    // entries used defaults to EXECUTABLE_ALLOCATOR_DEFAULT_CACHE_SIZE and can
+    // be overridden up to the physical size of the array using the
+    // EXECUTABLE_ALLOCATOR_CACHE_SIZE environment variable.
     static int g_cachedMappingSize;
     BlockRW* m_cachedMapping[16] = { 0 };
-#else
-    BlockRW* m_cachedMapping[3] = { 0 };
-#endif
+
+    // Head of the linked list of RW blocks whose refcount dropped to zero and
+    // that are waiting to be unmapped. The unmapping is done after the critical
+    // section is left so that the OS calls don't block other threads entering
+    // MapRW / UnmapRW.
+    BlockRW* m_pFirstPendingUnmapRW = NULL;
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
@@ -152,10 +153,19 @@ private:
     // Add RW block to the list of existing RW blocks
     bool AddRWBlock(void* baseRW, void* baseRX, size_t size, CacheableMapping cacheMapping);
 
-    // Remove RW block from the list of existing RW blocks and return the base
-    // address and size the underlying memory was mapped at.
+    // Decrement the refcount of the RW block containing the passed in address.
+    // When it drops to zero, remove the block from the list of existing RW blocks
+    // and move it to the pending unmap list.
     // Return false if no existing RW block contains the passed in address.
-    bool RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t* pUnmapSize);
+    bool RemoveRWBlock(void* pRW);
+
+    // Detach the list of RW blocks pending unmap and return its head.
+    // Must be called with the critical section held.
+    BlockRW* DetachPendingUnmapList();
+
+    // Unmap and delete all RW blocks on the passed in list. Called by the hot
+    // paths after the critical section is left.
+    static void ReleasePendingUnmapList(BlockRW* pList);
 
     // Find a free block with the closest size >= the requested size.
     // Returns NULL if no such block exists.
@@ -267,6 +267,48 @@ class EMPTY_BASES_DECL SHash : public TRAITS
 
     void Reallocate(count_t newTableSize);
 
+    // Support for lookups that are asynchronous with Add (see the synchronization
+    // notes at the top of this file). A caller that provides its own versioning
+    // scheme can capture the current table with code:GetTableSnapshot, probe it with
+    // code:LookupInTable, and grow via code:PrepareGrowth + code:ReplaceTable so that
+    // the replaced table is handed to code:DeleteOldTable only once no concurrent
+    // reader can still reference it.
+
+    // Capture the current table pointer and size. The pair is consistent only if the
+    // caller can prove that no Add/Remove/Reallocate ran concurrently with the
+    // capture (e.g. by validating a version stamp around it).
+    PTR_element_t GetTableSnapshot(count_t * pTableSize) const
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        *pTableSize = m_tableSize;
+        return m_table;
+    }
+
+    // Probe a table captured by code:GetTableSnapshot for the given key.
+    const element_t * LookupInTable(PTR_element_t table, count_t tableSize, key_t key) const
+    {
+        WRAPPER_NO_CONTRACT;
+        return Lookup(table, tableSize, key);
+    }
+
+    // See if adding one element requires growth, and if so allocate (but do not yet
+    // publish) the replacement table. Returns TRUE when a table was allocated; the
+    // caller must then install it with code:ReplaceTable. Splitting the allocation
+    // from the publication lets the caller bracket only the non-throwing publication
+    // with its versioning scheme.
+    BOOL PrepareGrowth(element_t ** pNewTable, count_t * pcNewTableSize);
+
+    // Utility function to replace old table with newly allocated table (as allocated by
+    // code:AllocateNewTable or code:PrepareGrowth). Copies all 'old' values into the new
+    // table first. Returns the old table. Caller is expected to delete it (via
+    // code:DeleteOldTable).
+    // Phase 2 of code:Reallocate
+    element_t * ReplaceTable(element_t * newTable, count_t newTableSize);
+
+    // Utility function to delete old table (as returned by code:ReplaceTable).
+    // Phase 3 of code:Reallocate
+    void DeleteOldTable(element_t * oldTable);
+
     // Makes a call on the Functor for each element in the hash table, passing
     // the element as an argument. Functor is expected to look like this:
     //
@@ -305,16 +347,6 @@ class EMPTY_BASES_DECL SHash : public TRAITS
     // NoThrow version of AllocateNewTable utility function. Returns NULL on failure.
     element_t * AllocateNewTableNoThrow(count_t requestedSize, count_t * pcNewTableSize);
 
-    // Utility function to replace old table with newly allocated table (as allocated by
-    // code:AllocateNewTable). Copies all 'old' values into the new table first.
-    // Returns the old table. Caller is expected to delete it (via code:DeleteOldTable).
-    // Phase 2 of code:Reallocate
-    element_t * ReplaceTable(element_t * newTable, count_t newTableSize);
-
-    // Utility function to delete old table (as returned by code:ReplaceTable).
-    // Phase 3 of code:Reallocate
-    void DeleteOldTable(element_t * oldTable);
-
     // Utility function that does not call code:CheckGrowth.
     // Add an element to the hash table.  This will never replace an element; multiple
     // elements may be stored with the same key.
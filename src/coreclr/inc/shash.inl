@@ -411,6 +411,27 @@ BOOL SHash<TRAITS>::CheckGrowthNoThrow()
     RETURN result;
 }
 
+template <typename TRAITS>
+BOOL SHash<TRAITS>::PrepareGrowth(element_t ** pNewTable, count_t * pcNewTableSize)
+{
+    CONTRACT(BOOL)
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INSTANCE_CHECK;
+    }
+    CONTRACT_END;
+
+    if (m_tableOccupied != m_tableMax)
+    {
+        *pNewTable = NULL;
+        RETURN FALSE;
+    }
+
+    *pNewTable = Grow_OnlyAllocateNewTable(pcNewTableSize);
+    RETURN TRUE;
+}
+
 template <typename TRAITS>
 void SHash<TRAITS>::Grow()
 {
@@ -690,11 +690,12 @@ void Compiler::optAssertionInit(bool isLocalProp)
 
         // Use a function countFunc to determine a proper maximum assertion count for the
         // method being compiled. The function is linear to the IL size for small and
-        // moderate methods. For large methods, considering throughput impact, we track no
-        // more than 64 assertions.
+        // moderate methods. For large methods, considering throughput impact, we taper
+        // back down to 128 assertions rather than falling all the way to 64, since such
+        // methods tend to have the most bounds checks to prove away.
         // Note this tracks at most only 256 assertions.
         //
-        static const AssertionIndex countFunc[] = {64, 128, 256, 128, 64};
+        static const AssertionIndex countFunc[] = {64, 128, 256, 256, 128};
         static const unsigned       upperBound  = ArrLen(countFunc) - 1;
         const unsigned              codeSize    = info.compILCodeSize / 512;
         optMaxAssertionCount                    = countFunc[min(upperBound, codeSize)];
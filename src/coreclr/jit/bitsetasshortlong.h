@@ -785,16 +785,18 @@ bool BitSetOps</*BitSetType*/ BitSetShortLongRep,
                                                                  BitSetShortLongRep  bs2)
 {
     assert(!IsShort(env));
-    bool     changed = false;
-    unsigned len     = BitSetTraits::GetArrSize(env);
+    // Accumulate the changed bits instead of a bool so that the loop body has
+    // no cross-iteration dependency on a flag and can be auto-vectorized.
+    size_t   changedBits = 0;
+    unsigned len         = BitSetTraits::GetArrSize(env);
     for (unsigned i = 0; i < len; i++)
     {
         size_t bsCurrent = bs1[i];
         size_t bsNew     = bsCurrent | bs2[i];
-        changed |= bsNew != bsCurrent;
+        changedBits |= bsNew ^ bsCurrent;
         bs1[i] = bsNew;
     }
-    return changed;
+    return changedBits != 0;
 }
 
 template <typename Env, typename BitSetTraits>
@@ -953,7 +955,20 @@ bool BitSetOps</*BitSetType*/ BitSetShortLongRep,
 {
     assert(!IsShort(env));
     unsigned len = BitSetTraits::GetArrSize(env);
-    for (unsigned i = 0; i < len; i++)
+    unsigned i   = 0;
+
+    // Test four words per iteration: the branchless block body vectorizes
+    // while still exiting early (at block granularity) on a hit.
+    for (; i + 4 <= len; i += 4)
+    {
+        size_t nonEmpty = (bs1[i] & bs2[i]) | (bs1[i + 1] & bs2[i + 1]) | (bs1[i + 2] & bs2[i + 2]) |
+                          (bs1[i + 3] & bs2[i + 3]);
+        if (nonEmpty != 0)
+        {
+            return false;
+        }
+    }
+    for (; i < len; i++)
     {
         if ((bs1[i] & bs2[i]) != 0)
         {
@@ -970,15 +985,16 @@ bool BitSetOps</*BitSetType*/ BitSetShortLongRep,
                /*BitSetTraits*/ BitSetTraits>::IsEmptyUnionLong(Env env, BitSetShortLongRep bs1, BitSetShortLongRep bs2)
 {
     assert(!IsShort(env));
-    unsigned len = BitSetTraits::GetArrSize(env);
+    // An empty union means every word of both sets is zero, so there is no
+    // early exit to lose by accumulating over the whole array; the branchless
+    // loop vectorizes.
+    size_t   nonEmpty = 0;
+    unsigned len      = BitSetTraits::GetArrSize(env);
     for (unsigned i = 0; i < len; i++)
     {
-        if ((bs1[i] | bs2[i]) != 0)
-        {
-            return false;
-        }
+        nonEmpty |= bs1[i] | bs2[i];
     }
-    return true;
+    return nonEmpty == 0;
 }
 
 template <typename Env, typename BitSetTraits>
@@ -1024,7 +1040,19 @@ bool BitSetOps</*BitSetType*/ BitSetShortLongRep,
 {
     assert(!IsShort(env));
     unsigned len = BitSetTraits::GetArrSize(env);
-    for (unsigned i = 0; i < len; i++)
+    unsigned i   = 0;
+
+    // Compare four words per iteration; see IsEmptyIntersectionLong.
+    for (; i + 4 <= len; i += 4)
+    {
+        size_t diffBits = (bs1[i] ^ bs2[i]) | (bs1[i + 1] ^ bs2[i + 1]) | (bs1[i + 2] ^ bs2[i + 2]) |
+                          (bs1[i + 3] ^ bs2[i + 3]);
+        if (diffBits != 0)
+        {
+            return false;
+        }
+    }
+    for (; i < len; i++)
     {
         if (bs1[i] != bs2[i])
         {
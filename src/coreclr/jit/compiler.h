@@ -4504,6 +4504,13 @@ protected:
 
     GenTree* impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORINFO_CLASS_HANDLE ownerCls);
 
+    bool impFoldReadOnlyStructFields(CORINFO_CLASS_HANDLE clsHnd,
+                                     uint8_t*             buffer,
+                                     unsigned             baseOffset,
+                                     unsigned             structTempNum,
+                                     bool                 emitStores,
+                                     int                  depth);
+
     GenTree* impImportStaticFieldAddress(CORINFO_RESOLVED_TOKEN* pResolvedToken,
                                          CORINFO_ACCESS_FLAGS    access,
                                          CORINFO_FIELD_INFO*     pFieldInfo,
@@ -6146,6 +6153,7 @@ public:
 
     bool fgReorderBlocks(bool useProfile);
     void fgDoReversePostOrderLayout();
+    void fgSearchImprovedLayout();
     void fgMoveColdBlocks();
 
     template <bool hasEH>
@@ -7446,16 +7454,17 @@ public:
         int typeChecks = JitConfig.JitGuardedDevirtualizationMaxTypeChecks();
         if (typeChecks < 0)
         {
-            // Negative value means "it's up to JIT to decide"
-            if (IsTargetAbi(CORINFO_NATIVEAOT_ABI) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
+            // Negative value means "it's up to JIT to decide". Class profile
+            // histograms order the guesses by likelihood, so chains of up to
+            // three guards pay for themselves at call sites with several
+            // dominant receiver types; fall back to a single check when
+            // optimizing for size.
+            if (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
             {
-                return 3;
+                return 1;
             }
 
-            // We plan to use 3 for CoreCLR too, but we need to make sure it doesn't regress performance
-            // as CoreCLR heavily relies on Dynamic PGO while for NativeAOT we *usually* don't have it and
-            // can only perform the "exact" devirtualization.
-            return 1;
+            return 3;
         }
 
         // MAX_GDV_TYPE_CHECKS is the upper limit. The constant can be changed, we just suspect that even
@@ -9375,7 +9384,10 @@ public:
             //   ldp q0, q1, [x1]
             //   stp q0, q1, [x0]
             //
-            threshold = maxRegSize * 2;
+            // and back-to-back q-register pairs keep the load/store pipes busy,
+            // so allow twice as many of them before falling back to memcpy/memset
+            // helper calls.
+            threshold = maxRegSize * 4;
 #endif
         }
 #if defined(TARGET_XARCH)
@@ -9402,7 +9414,7 @@ public:
         // | x86 avx512  |   512  |   256  |
         // | x86 avx     |   256  |   128  |
         // | x86 sse     |   128  |    64  |
-        // | arm64       |   256  |   128  | ldp/stp (2x128bit)
+        // | arm64       |   512  |   256  | ldp/stp (2x128bit)
         // | arm         |    32  |    16  | no SIMD support
         // | loongarch64 |    64  |    32  | no SIMD support
         // | riscv64     |    64  |    32  | no SIMD support
@@ -2595,8 +2595,12 @@ private:
 #define SC_IG_BUFFER_NUM_LARGE_DESCS 200
 
 #else
-#define SC_IG_BUFFER_NUM_SMALL_DESCS 14
-#define SC_IG_BUFFER_NUM_LARGE_DESCS 50
+// Size the buffer so that straight-line code gets reasonably close to the
+// EMIT_MAX_IG_INS_COUNT cap before spilling into an extension group: every
+// extension group costs list management and an extra stop in all the
+// emitter passes that walk the IG list.
+#define SC_IG_BUFFER_NUM_SMALL_DESCS 32
+#define SC_IG_BUFFER_NUM_LARGE_DESCS 128
 #endif // !(TARGET_ARMARCH || TARGET_LOONGARCH64 || TARGET_RISCV64)
 
     size_t emitIGbuffSize;
@@ -4586,6 +4586,11 @@ void Compiler::fgDoReversePostOrderLayout()
 
         fgMoveHotJumps</* hasEH */ false>();
 
+        if (JitConfig.JitDoLayoutSearch())
+        {
+            fgSearchImprovedLayout();
+        }
+
         return;
     }
 
@@ -4759,6 +4764,199 @@ void Compiler::fgDoReversePostOrderLayout()
     }
 }
 
+//-----------------------------------------------------------------------------
+// fgSearchImprovedLayout: Try to improve upon the current block order with a
+//   bounded 3-opt style search that moves whole segments of the layout,
+//   maximizing the total likely weight of edges that fall through.
+//
+// Notes:
+//   Runs only on methods without EH, after fgDoReversePostOrderLayout has
+//   established an initial order; for methods with EH regions, keeping the
+//   regions contiguous leaves little room for cross-method moves.
+//   Moving a segment changes the fallthrough behavior at three cut points
+//   only, so each candidate move is evaluated in constant time.
+//
+void Compiler::fgSearchImprovedLayout()
+{
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("*************** In fgSearchImprovedLayout()\n");
+
+        printf("\nInitial BasicBlocks");
+        fgDispBasicBlocks(verboseTrees);
+        printf("\n");
+    }
+#endif // DEBUG
+
+    assert(compHndBBtabCount == 0);
+
+    unsigned blockCount = 0;
+    for (BasicBlock* const block : Blocks())
+    {
+        blockCount++;
+    }
+
+    // We need at least one block between a branch and its target for a move to be profitable
+    //
+    if (blockCount < 3)
+    {
+        return;
+    }
+
+    // Capture the current order, and each block's position in it
+    //
+    BasicBlock** const blockOrder = new (this, CMK_BasicBlock) BasicBlock*[blockCount];
+    BasicBlock** const tempOrder  = new (this, CMK_BasicBlock) BasicBlock*[blockCount];
+    unsigned* const    ordinals   = new (this, CMK_BasicBlock) unsigned[fgBBNumMax + 1];
+
+    unsigned position = 0;
+    for (BasicBlock* const block : Blocks())
+    {
+        blockOrder[position]     = block;
+        ordinals[block->bbNum]   = position;
+        position++;
+    }
+
+    // Returns the edge block would most like to fall through, or nullptr if
+    // block's kind does not allow a fallthrough successor
+    //
+    auto getLikelyEdge = [](BasicBlock* block) -> FlowEdge* {
+        if (block->KindIs(BBJ_ALWAYS))
+        {
+            return block->GetTargetEdge();
+        }
+
+        if (block->KindIs(BBJ_COND))
+        {
+            return (block->GetTrueEdge()->getLikelihood() > 0.5) ? block->GetTrueEdge() : block->GetFalseEdge();
+        }
+
+        return nullptr;
+    };
+
+    // Returns the weight we would save by laying 'to' out right after 'from'
+    //
+    auto fallthroughWeight = [this](BasicBlock* from, BasicBlock* to) -> weight_t {
+        if ((from == nullptr) || (to == nullptr) || !from->KindIs(BBJ_ALWAYS, BBJ_COND))
+        {
+            return BB_ZERO_WEIGHT;
+        }
+
+        FlowEdge* const edge = fgGetPredForBlock(to, from);
+        return (edge != nullptr) ? edge->getLikelyWeight() : BB_ZERO_WEIGHT;
+    };
+
+    bool           modified  = false;
+    bool           improved  = true;
+    const unsigned maxPasses = 3;
+
+    for (unsigned pass = 0; improved && (pass < maxPasses); pass++)
+    {
+        improved = false;
+
+        for (unsigned i = 0; i < blockCount - 1; i++)
+        {
+            BasicBlock* const block = blockOrder[i];
+
+            // Don't bother improving the placement of cold paths
+            //
+            if (block->isBBWeightCold(this))
+            {
+                continue;
+            }
+
+            FlowEdge* const targetEdge = getLikelyEdge(block);
+            if (targetEdge == nullptr)
+            {
+                continue;
+            }
+
+            BasicBlock* const target = targetEdge->getDestinationBlock();
+            const unsigned    j      = ordinals[target->bbNum];
+
+            // Skip branches that already fall through, as well as backward jumps;
+            // the latter are typically loop backedges that we don't want to disturb
+            //
+            if (j <= (i + 1))
+            {
+                continue;
+            }
+
+            // Extend the segment forward while the layout falls through,
+            // so that we move whole chains rather than breaking them up
+            //
+            unsigned k = j;
+            while ((k + 1) < blockCount)
+            {
+                FlowEdge* const chainEdge = getLikelyEdge(blockOrder[k]);
+                if ((chainEdge == nullptr) || (chainEdge->getDestinationBlock() != blockOrder[k + 1]))
+                {
+                    break;
+                }
+
+                k++;
+            }
+
+            // Compute the score delta from moving [j..k] to just after block.
+            // Only the three cut points change their fallthrough behavior.
+            //
+            BasicBlock* const afterBlock = blockOrder[i + 1];
+            BasicBlock* const beforeSeg  = blockOrder[j - 1];
+            BasicBlock* const segFirst   = blockOrder[j];
+            BasicBlock* const segLast    = blockOrder[k];
+            BasicBlock* const afterSeg   = ((k + 1) < blockCount) ? blockOrder[k + 1] : nullptr;
+
+            const weight_t oldScore = fallthroughWeight(block, afterBlock) + fallthroughWeight(beforeSeg, segFirst) +
+                                      fallthroughWeight(segLast, afterSeg);
+            const weight_t newScore = fallthroughWeight(block, segFirst) + fallthroughWeight(segLast, afterBlock) +
+                                      fallthroughWeight(beforeSeg, afterSeg);
+
+            if (newScore <= oldScore)
+            {
+                continue;
+            }
+
+            JITDUMP("Moving [" FMT_BB ".." FMT_BB "] after " FMT_BB " (score delta " FMT_WT ")\n", segFirst->bbNum,
+                    segLast->bbNum, block->bbNum, newScore - oldScore);
+
+            // Rotate [i+1..k] so the segment comes first, and update the moved blocks' positions
+            //
+            const unsigned segLength = k - j + 1;
+            memcpy(tempOrder, &blockOrder[j], segLength * sizeof(BasicBlock*));
+            memmove(&blockOrder[i + 1 + segLength], &blockOrder[i + 1], (j - i - 1) * sizeof(BasicBlock*));
+            memcpy(&blockOrder[i + 1], tempOrder, segLength * sizeof(BasicBlock*));
+
+            for (unsigned pos = i + 1; pos <= k; pos++)
+            {
+                ordinals[blockOrder[pos]->bbNum] = pos;
+            }
+
+            improved = true;
+            modified = true;
+        }
+    }
+
+    if (!modified)
+    {
+        return;
+    }
+
+    // Rewrite the block list to match the improved order
+    //
+    for (unsigned i = 1; i < blockCount; i++)
+    {
+        BasicBlock* const block       = blockOrder[i - 1];
+        BasicBlock* const blockToMove = blockOrder[i];
+
+        if (!block->NextIs(blockToMove))
+        {
+            fgUnlinkBlock(blockToMove);
+            fgInsertBBafter(block, blockToMove);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // fgMoveColdBlocks: Move rarely-run blocks to the end of their respective regions.
 //
@@ -3634,6 +3634,25 @@ GenTree* Compiler::impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORI
                 }
 #endif
 
+                // Next, try to flatten the struct into constant stores to a local, field by
+                // field, recursing into nested structs. Validate the whole layout first so
+                // we don't emit partial stores if some field turns out to be unsupported.
+                if (impFoldReadOnlyStructFields(fieldClsHnd, buffer, 0, BAD_VAR_NUM, /* emitStores */ false, 0))
+                {
+                    unsigned structTempNum = lvaGrabTemp(true DEBUGARG("folding static readonly field struct"));
+                    lvaSetStruct(structTempNum, fieldClsHnd, false);
+
+                    // Zero the whole temp first so padding and all-zero fields are defined.
+                    impStoreToTemp(structTempNum, gtNewIconNode(0), CHECK_SPILL_NONE);
+
+                    bool folded =
+                        impFoldReadOnlyStructFields(fieldClsHnd, buffer, 0, structTempNum, /* emitStores */ true, 0);
+                    assert(folded);
+
+                    JITDUMP("Success! Optimizing to a sequence of STORE_LCL_FLD(CNS) nodes.");
+                    return gtNewLclVarNode(structTempNum);
+                }
+
                 for (unsigned i = 0; i < totalSize; i++)
                 {
                     if (buffer[i] != 0)
@@ -3706,6 +3725,95 @@ GenTree* Compiler::impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORI
     return nullptr;
 }
 
+//------------------------------------------------------------------------
+// impFoldReadOnlyStructFields: Helper for impImportStaticReadOnlyField. Walks the
+//    instance fields of a struct whose constant content was read into 'buffer' and
+//    stores each primitive field's value into the given struct local, recursing
+//    into nested structs.
+//
+// Arguments:
+//    clsHnd        - class handle of the struct
+//    buffer        - constant content of the whole struct
+//    baseOffset    - offset of this struct within the buffer and the local
+//    structTempNum - struct local to store into (ignored when emitStores is false)
+//    emitStores    - false to only validate that the layout is foldable,
+//                    true to append the constant field stores
+//    depth         - current struct nesting depth
+//
+// Return Value:
+//    true if all fields can be (or were) folded into constant stores. Fields that
+//    are neither integral, floating point nor nested structs of such make the fold
+//    fail - gc refs would need frozen object handles rather than raw bytes.
+//
+bool Compiler::impFoldReadOnlyStructFields(CORINFO_CLASS_HANDLE clsHnd,
+                                           uint8_t*             buffer,
+                                           unsigned             baseOffset,
+                                           unsigned             structTempNum,
+                                           bool                 emitStores,
+                                           int                  depth)
+{
+    // Keep the fold cheap: deeply nested or many-field config structs are unlikely
+    // to be on a hot enough path to justify the extra jit time.
+    const int      MaxFoldDepth  = 4;
+    const unsigned MaxFoldFields = 16;
+
+    if (depth >= MaxFoldDepth)
+    {
+        return false;
+    }
+
+    unsigned fieldsCnt = info.compCompHnd->getClassNumInstanceFields(clsHnd);
+    if ((fieldsCnt == 0) || (fieldsCnt > MaxFoldFields))
+    {
+        return false;
+    }
+
+    for (unsigned i = 0; i < fieldsCnt; i++)
+    {
+        CORINFO_FIELD_HANDLE fieldHnd = info.compCompHnd->getFieldInClass(clsHnd, i);
+        CORINFO_CLASS_HANDLE fieldClsHnd;
+        var_types fieldType = JITtype2varType(info.compCompHnd->getFieldType(fieldHnd, &fieldClsHnd, clsHnd));
+        unsigned  fldOffset = baseOffset + info.compCompHnd->getFieldOffset(fieldHnd);
+
+        if (fieldType == TYP_STRUCT)
+        {
+            if (!impFoldReadOnlyStructFields(fieldClsHnd, buffer, fldOffset, structTempNum, emitStores, depth + 1))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (!varTypeIsIntegral(fieldType) && !varTypeIsFloating(fieldType))
+        {
+            return false;
+        }
+
+        if (emitStores)
+        {
+            uint8_t* fieldValue = buffer + fldOffset;
+
+            // The local was zero initialized, so all-zero fields need no store.
+            bool isZero = true;
+            for (unsigned b = 0; b < genTypeSize(fieldType); b++)
+            {
+                isZero &= (fieldValue[b] == 0);
+            }
+
+            if (!isZero)
+            {
+                GenTree* constValTree = gtNewGenericCon(fieldType, fieldValue);
+                assert(constValTree != nullptr);
+
+                GenTree* fieldStoreTree = gtNewStoreLclFldNode(structTempNum, fieldType, fldOffset, constValTree);
+                impAppendTree(fieldStoreTree, CHECK_SPILL_NONE, impCurStmtDI);
+            }
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // impImportStaticFieldAddress: Generate an address of a static field
 //
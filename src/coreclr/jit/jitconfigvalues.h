@@ -769,6 +769,10 @@ RELEASE_CONFIG_INTEGER(JitEnableCrossBlockLocalAssertionProp, W("JitEnableCrossB
 // Do greedy RPO-based layout in Compiler::fgReorderBlocks.
 RELEASE_CONFIG_INTEGER(JitDoReversePostOrderLayout, W("JitDoReversePostOrderLayout"), 1);
 
+// After RPO-based layout, search for a better order by moving whole layout segments
+// so that hot edges become fallthrough.
+RELEASE_CONFIG_INTEGER(JitDoLayoutSearch, W("JitDoLayoutSearch"), 1);
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
@@ -13008,7 +13008,7 @@ void LinearScan::RegisterSelection::try_REG_ORDER()
         SingleTypeRegSet regOrderCandidateBit    = genSingleTypeRegMask(regOrderCandidateRegNum);
         regOrderCandidates ^= regOrderCandidateBit;
 
-        unsigned thisRegOrder = linearScan->getRegisterRecord(regOrderCandidateRegNum)->regOrder;
+        unsigned thisRegOrder = linearScan->regOrderMap[regOrderCandidateRegNum];
         if (thisRegOrder < lowestRegOrder)
         {
             lowestRegOrder    = thisRegOrder;
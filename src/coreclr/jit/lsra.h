@@ -1624,6 +1624,11 @@ private:
 
     RegRecord physRegs[REG_COUNT];
 
+    // Flat copy of RegRecord::regOrder, indexed by register number. The
+    // REG_ORDER tie-breaker consults this instead of chasing a RegRecord per
+    // candidate; the whole map fits in a cache line or two.
+    unsigned char regOrderMap[REG_COUNT];
+
     // Map from tracked variable index to Interval*.
     Interval** localVarIntervals;
 
@@ -1991,6 +1991,11 @@ void LinearScan::buildPhysRegRecords()
         }
     }
 #endif // TARGET_XARCH
+
+    for (regNumber reg = REG_FIRST; reg < AVAILABLE_REG_COUNT; reg = REG_NEXT(reg))
+    {
+        regOrderMap[reg] = physRegs[reg].regOrder;
+    }
 }
 
 //------------------------------------------------------------------------
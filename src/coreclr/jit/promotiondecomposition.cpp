@@ -333,13 +333,27 @@ private:
                     case 4:
                         primitiveType = TYP_INT;
                         break;
-#ifdef TARGET_64BIT
                     case 8:
+#ifdef TARGET_64BIT
                         primitiveType = TYP_LONG;
-                        break;
+#elif defined(FEATURE_SIMD)
+                        // On 32-bit targets an 8-byte hole can still be
+                        // plugged with a single half-vector move.
+                        if (m_compiler->getPreferredVectorByteLength() >= 16)
+                        {
+                            primitiveType = TYP_SIMD8;
+                        }
 #endif
+                        break;
 
 #ifdef FEATURE_SIMD
+                    case 12:
+                        if (m_compiler->getPreferredVectorByteLength() >= 16)
+                        {
+                            primitiveType = TYP_SIMD12;
+                        }
+                        break;
+
                     case 16:
                         if (m_compiler->getPreferredVectorByteLength() >= 16)
                         {
@@ -279,17 +279,16 @@ bool Compiler::optSwitchConvert(
     int testIdx = 0;
     for (; testIdx < testsCount; testIdx++)
     {
+        // Negative values are fine - the switch value is rebased by SUB(val, minValue) below,
+        // all that matters is the distance between min and max.
         ssize_t testValue = testValues[testIdx];
-        if (testValue < 0)
-        {
-            // We don't support negative values
-            break;
-        }
 
         const ssize_t newMinValue = min(minValue, testValue);
         const ssize_t newMaxValue = max(maxValue, testValue);
         assert(newMaxValue >= newMinValue);
-        if ((newMaxValue - newMinValue) > SWITCH_MAX_DISTANCE)
+        // Compute the distance as unsigned: a chain mixing values near SSIZE_MIN and SSIZE_MAX
+        // would overflow a signed subtraction, and the overflowed result could pass the check.
+        if (((size_t)newMaxValue - (size_t)newMinValue) > (size_t)SWITCH_MAX_DISTANCE)
         {
             // Stop here, the distance between min and max is too big
             break;
@@ -308,8 +307,10 @@ bool Compiler::optSwitchConvert(
         return false;
     }
 
-    // if MaxValue is less than SWITCH_MAX_DISTANCE then don't bother with SUB(val, minValue)
-    if (maxValue <= SWITCH_MAX_DISTANCE)
+    // if the values already fit in [0..SWITCH_MAX_DISTANCE] then don't bother with SUB(val, minValue).
+    // A negative minValue must keep the rebase: dropping it would map the negative cases onto
+    // huge unsigned indices and send them to the default case.
+    if ((minValue >= 0) && (maxValue <= SWITCH_MAX_DISTANCE))
     {
         minValue = 0;
     }
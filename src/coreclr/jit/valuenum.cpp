@@ -502,6 +502,40 @@ ValueNumStore::ValueNumStore(Compiler* comp, CompAllocator alloc)
 #endif
 }
 
+//------------------------------------------------------------------------
+// initialFuncAppMapSize: Estimate an initial bucket count for a VNFunc
+//    interning map.
+//
+// Arguments:
+//    funcsPerBlock - rough number of distinct func applications expected per
+//                    basic block for the map's arity
+//
+// Return Value:
+//    A bucket count scaled by the method's basic block count, clamped so that
+//    small methods keep the default footprint and huge methods do not
+//    over-allocate.
+//
+// Notes:
+//    Value numbering of large methods is dominated by func application
+//    lookups; priming the maps up front avoids growing them through many
+//    rehashing steps as entries accumulate.
+//
+unsigned ValueNumStore::initialFuncAppMapSize(unsigned funcsPerBlock)
+{
+    unsigned size = m_pComp->fgBBcount * funcsPerBlock;
+
+    if (size < 16)
+    {
+        size = 16;
+    }
+    else if (size > 16384)
+    {
+        size = 16384;
+    }
+
+    return size;
+}
+
 //
 // Unary EvalOp
 //
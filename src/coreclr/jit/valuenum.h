@@ -1844,6 +1844,10 @@ private:
         return m_VNFunc0Map;
     }
 
+    // Returns an initial bucket count for a VNFunc interning map, scaled by
+    // the method's basic block count. Defined in valuenum.cpp.
+    unsigned initialFuncAppMapSize(unsigned funcsPerBlock);
+
     typedef VNMap<VNDefFuncApp<1>, VNDefFuncAppKeyFuncs<1>> VNFunc1ToValueNumMap;
     VNFunc1ToValueNumMap*                                   m_VNFunc1Map;
     VNFunc1ToValueNumMap*                                   GetVNFunc1Map()
@@ -1851,6 +1855,7 @@ private:
         if (m_VNFunc1Map == nullptr)
         {
             m_VNFunc1Map = new (m_alloc) VNFunc1ToValueNumMap(m_alloc);
+            m_VNFunc1Map->Reallocate(initialFuncAppMapSize(/* funcsPerBlock */ 2));
         }
         return m_VNFunc1Map;
     }
@@ -1862,6 +1867,7 @@ private:
         if (m_VNFunc2Map == nullptr)
         {
             m_VNFunc2Map = new (m_alloc) VNFunc2ToValueNumMap(m_alloc);
+            m_VNFunc2Map->Reallocate(initialFuncAppMapSize(/* funcsPerBlock */ 4));
         }
         return m_VNFunc2Map;
     }
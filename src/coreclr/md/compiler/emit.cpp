@@ -1334,6 +1334,9 @@ STDMETHODIMP RegMeta::GetTokenFromTypeSpec(   // [IN] S_OK or error.
         pTypeSpecRec,
         pvSig,
         cbSig));
+
+    IfFailGo(m_pStgdb->m_MiniMd.AddTypeSpecToHash(*ptypespec));
+
     IfFailGo(UpdateENCLog(*ptypespec));
 
 ErrExit:
@@ -2131,7 +2134,7 @@ STDMETHODIMP RegMeta::DefineMethodSpec( // S_OK or error
     HRESULT hr = S_OK;
 
     MethodSpecRec   *pRecord = 0;       // The MethodSpec record.
-    RID             iRecord;            // RID of new MethodSpec record.
+    RID             iRecord = 0;        // RID of new MethodSpec record.
 
     LOCKWRITE();
 
@@ -2187,8 +2190,10 @@ STDMETHODIMP RegMeta::DefineMethodSpec( // S_OK or error
     IfFailGo(m_pStgdb->m_MiniMd.PutToken(TBL_MethodSpec, MethodSpecRec::COL_Method, pRecord, tkImport));
     IfFailGo(m_pStgdb->m_MiniMd.PutBlob(TBL_MethodSpec, MethodSpecRec::COL_Instantiation, pRecord,
                                 pvSigBlob, cbSigBlob));
-    /*@GENERICS: todo: update MethodSpec hash table  */
-    /* IfFailGo(m_pStgdb->m_MiniMd.AddMemberRefToHash(*pmi) ); */
+    // Update the hash for new records only; an ENC re-define reuses the record, which
+    // is already in the hash.
+    if (iRecord != 0)
+        IfFailGo(m_pStgdb->m_MiniMd.AddMethodSpecToHash(*pmi));
 
     IfFailGo(UpdateENCLog(*pmi));
 
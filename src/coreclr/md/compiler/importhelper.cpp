@@ -19,7 +19,6 @@
 //*******************************************************************************
 // Find the MethodSpec by Method and Instantiation
 //*******************************************************************************
-//@GENERICS: todo: look in hashtable (cf. MetaModelRW.cpp) if necessary
 HRESULT ImportHelper::FindMethodSpecByMethodAndInstantiation(
     CMiniMdRW   *pMiniMd,                   // [IN] the minimd to lookup
     /*mdMethodDefOrRef*/ mdToken tkMethod,  // [IN] MethodSpec method field
@@ -35,9 +34,21 @@ HRESULT ImportHelper::FindMethodSpecByMethodAndInstantiation(
     ULONG       cbInstantiationTmp;
     ULONG       cMethodSpecs;
     ULONG       i;
+    CMiniMdRW::HashSearchResult rtn;
 
     _ASSERTE(pMethodSpec);
 
+    rtn = pMiniMd->FindMethodSpecFromHash(tkMethod, pInstantiation, cbInstantiation, rid, pMethodSpec);
+    if (rtn == CMiniMdRW::Found)
+    {
+        return S_OK;
+    }
+    else if (rtn == CMiniMdRW::NotFound)
+    {
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cMethodSpecs = pMiniMd->getCountMethodSpecs();
 
     // linear scan through the MethodSpec table
@@ -508,11 +519,23 @@ HRESULT ImportHelper::FindStandAloneSig(
     StandAloneSigRec    *pRec;
     const COR_SIGNATURE *pbSigTmp;          // Signature.
     ULONG       cbSigTmp;                   // Size of signature.
+    CMiniMdRW::HashSearchResult rtn;
 
 
     _ASSERTE(cbSig &&  psa);
     *psa = mdSignatureNil;
 
+    rtn = pMiniMd->FindStandAloneSigFromHash(pbSig, cbSig, psa);
+    if (rtn == CMiniMdRW::Found)
+    {
+        return S_OK;
+    }
+    else if (rtn == CMiniMdRW::NotFound)
+    {
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cRecs = pMiniMd->getCountStandAloneSigs();
 
     // Search for the StandAloneSignature
@@ -547,11 +570,23 @@ ImportHelper::FindTypeSpec(
     TypeSpecRec * pRec;
     const COR_SIGNATURE * pbSigTmp; // Signature.
     ULONG                 cbSigTmp; // Size of signature.
+    CMiniMdRW::HashSearchResult rtn;
 
     // cbSig can be 0
     _ASSERTE(pTypeSpec != NULL);
     *pTypeSpec = mdSignatureNil;
 
+    rtn = pMiniMd->FindTypeSpecFromHash(pbSig, cbSig, pTypeSpec);
+    if (rtn == CMiniMdRW::Found)
+    {
+        return S_OK;
+    }
+    else if (rtn == CMiniMdRW::NotFound)
+    {
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+    _ASSERTE(rtn == CMiniMdRW::NoTable);
+
     cRecs = pMiniMd->getCountTypeSpecs();
 
     // Search for the TypeSpec
@@ -1897,6 +1932,11 @@ ImportHelper::MergeUpdateTokenInFieldSig(
                             (PCCOR_SIGNATURE) (qkTypeSpecSigEmit.Ptr()),
                             cbTypeSpecEmit));
                         tkRidTo = TokenFromRid( tkRidTo, mdtTypeSpec );
+
+                        // Keep the TypeSpec hash in sync so later dup checks,
+                        // which treat a hash miss as authoritative, find this record.
+                        IfFailGo(pMiniMdEmit->AddTypeSpecToHash(tkRidTo));
+
                         IfFailGo(pMiniMdEmit->UpdateENCLog(tkRidTo));
                     }
                     IfFailGo( hr );
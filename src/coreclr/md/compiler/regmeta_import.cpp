@@ -1028,6 +1028,9 @@ HRESULT RegMeta::_GetTokenFromSig(              // S_OK or error.
     // Save signature.
     IfFailGo(m_pStgdb->m_MiniMd.PutBlob(TBL_StandAloneSig, StandAloneSigRec::COL_Signature,
                                 pSigRec, pvSig, cbSig));
+
+    IfFailGo(m_pStgdb->m_MiniMd.AddStandAloneSigToHash(*pmsig));
+
     IfFailGo(UpdateENCLog(*pmsig));
 ErrExit:
     return hr;
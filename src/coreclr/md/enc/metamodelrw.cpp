@@ -695,6 +695,9 @@ static bool bENCDeltaOnly = false;
 CMiniMdRW::CMiniMdRW()
  :  m_pMemberRefHash(0),
     m_pMemberDefHash(0),
+    m_pTypeSpecHash(0),
+    m_pStandAloneSigHash(0),
+    m_pMethodSpecHash(0),
     m_pNamedItemHash(0),
     m_pHandler(0),
     m_cbSaveSize(0),
@@ -797,6 +800,12 @@ CMiniMdRW::~CMiniMdRW()
         delete m_pMemberRefHash;
     if (m_pMemberDefHash)
         delete m_pMemberDefHash;
+    if (m_pTypeSpecHash)
+        delete m_pTypeSpecHash;
+    if (m_pStandAloneSigHash)
+        delete m_pStandAloneSigHash;
+    if (m_pMethodSpecHash)
+        delete m_pMethodSpecHash;
     if (m_pNamedItemHash)
         delete m_pNamedItemHash;
     if (m_pMethodMap)
@@ -6052,6 +6061,425 @@ CMiniMdRW::FindMemberRefFromHash(
     }
 } // CMiniMdRW::FindMemberRefFromHash
 
+//---------------------------------------------------------------------------------------
+//
+// Create TypeSpec hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::CreateTypeSpecHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pTypeSpecHash == NULL)
+    {
+        ULONG ridEnd = getCountTypeSpecs();
+        if (ridEnd + 1 > INDEX_ROW_COUNT_THRESHOLD)
+        {
+            // Create a new hash.
+            NewHolder<CMetaDataHashBase> pTypeSpecHash = new (nothrow) CMetaDataHashBase();
+            IfNullGo(pTypeSpecHash);
+            IfFailGo(pTypeSpecHash->NewInit(
+                g_HashSize[GetMetaDataSizeIndex(&m_OptionValue)]));
+
+            // Scan every entry already in the table, add it to the hash.
+            for (ULONG index = 1; index <= ridEnd; index++)
+            {
+                TypeSpecRec * pTypeSpec;
+                IfFailGo(GetTypeSpecRecord(index, &pTypeSpec));
+
+                PCCOR_SIGNATURE pvSigBlob;
+                ULONG           cbSigBlob;
+                IfFailGo(getSignatureOfTypeSpec(pTypeSpec, &pvSigBlob, &cbSigBlob));
+                ULONG iHash = HashSig(pvSigBlob, cbSigBlob);
+
+                TOKENHASHENTRY * pEntry = pTypeSpecHash->Add(iHash);
+                IfNullGo(pEntry);
+                pEntry->tok = TokenFromRid(index, mdtTypeSpec);
+            }
+
+            if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pTypeSpecHash, pTypeSpecHash, NULL) == NULL)
+            {   // We won the initialization race
+                pTypeSpecHash.SuppressRelease();
+            }
+        }
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::CreateTypeSpecHash
+
+//---------------------------------------------------------------------------------------
+//
+// Add a new TypeSpec to the hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::AddTypeSpecToHash(
+    mdTypeSpec ts)      // Token of new guy.
+{
+    HRESULT hr = S_OK;
+
+    // If the hash exists, we will add to it - requires write-lock
+    INDEBUG(Debug_CheckIsLockedForWrite();)
+
+    // If the hash table hasn't been built it, see if it should get faulted in.
+    if (m_pTypeSpecHash == NULL)
+    {
+        IfFailGo(CreateTypeSpecHash());
+    }
+    else
+    {
+        TypeSpecRec * pTypeSpec;
+        IfFailGo(GetTypeSpecRecord(RidFromToken(ts), &pTypeSpec));
+
+        PCCOR_SIGNATURE pvSigBlob;
+        ULONG           cbSigBlob;
+        IfFailGo(getSignatureOfTypeSpec(pTypeSpec, &pvSigBlob, &cbSigBlob));
+        ULONG iHash = HashSig(pvSigBlob, cbSigBlob);
+
+        TOKENHASHENTRY * pEntry = m_pTypeSpecHash->Add(iHash);
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(RidFromToken(ts), mdtTypeSpec);
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::AddTypeSpecToHash
+
+//---------------------------------------------------------------------------------------
+//
+// If the hash is built, search for a TypeSpec with the given signature.
+//
+CMiniMdRW::HashSearchResult
+CMiniMdRW::FindTypeSpecFromHash(
+    PCCOR_SIGNATURE pvSigBlob,      // Signature.
+    ULONG           cbSigBlob,      // Size of signature.
+    mdTypeSpec *    ptkTypeSpec)    // OUT: Return if found.
+{
+    // If the table is there, look for the item in the chain of items.
+    if (m_pTypeSpecHash != NULL)
+    {
+        TOKENHASHENTRY * p;
+        ULONG            iHash;
+        int              pos;
+
+        // Hash the data.
+        iHash = HashSig(pvSigBlob, cbSigBlob);
+
+        // Go through every entry in the hash chain looking for ours.
+        for (p = m_pTypeSpecHash->FindFirst(iHash, pos);
+             p != NULL;
+             p = m_pTypeSpecHash->FindNext(pos))
+        {
+            TypeSpecRec * pTypeSpec;
+            if (FAILED(GetTypeSpecRecord(RidFromToken(p->tok), &pTypeSpec)))
+                continue;
+
+            PCCOR_SIGNATURE pvSigBlobTmp;
+            ULONG           cbSigBlobTmp;
+            if (FAILED(getSignatureOfTypeSpec(pTypeSpec, &pvSigBlobTmp, &cbSigBlobTmp)))
+                continue;
+
+            if ((cbSigBlobTmp == cbSigBlob)
+                && (memcmp(pvSigBlob, pvSigBlobTmp, cbSigBlob) == 0))
+            {
+                *ptkTypeSpec = p->tok;
+                return Found;
+            }
+        }
+
+        return NotFound;
+    }
+    else
+    {
+        return NoTable;
+    }
+} // CMiniMdRW::FindTypeSpecFromHash
+
+//---------------------------------------------------------------------------------------
+//
+// Create StandAloneSig hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::CreateStandAloneSigHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pStandAloneSigHash == NULL)
+    {
+        ULONG ridEnd = getCountStandAloneSigs();
+        if (ridEnd + 1 > INDEX_ROW_COUNT_THRESHOLD)
+        {
+            // Create a new hash.
+            NewHolder<CMetaDataHashBase> pStandAloneSigHash = new (nothrow) CMetaDataHashBase();
+            IfNullGo(pStandAloneSigHash);
+            IfFailGo(pStandAloneSigHash->NewInit(
+                g_HashSize[GetMetaDataSizeIndex(&m_OptionValue)]));
+
+            // Scan every entry already in the table, add it to the hash.
+            for (ULONG index = 1; index <= ridEnd; index++)
+            {
+                StandAloneSigRec * pStandAloneSig;
+                IfFailGo(GetStandAloneSigRecord(index, &pStandAloneSig));
+
+                PCCOR_SIGNATURE pvSigBlob;
+                ULONG           cbSigBlob;
+                IfFailGo(getSignatureOfStandAloneSig(pStandAloneSig, &pvSigBlob, &cbSigBlob));
+                ULONG iHash = HashSig(pvSigBlob, cbSigBlob);
+
+                TOKENHASHENTRY * pEntry = pStandAloneSigHash->Add(iHash);
+                IfNullGo(pEntry);
+                pEntry->tok = TokenFromRid(index, mdtSignature);
+            }
+
+            if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pStandAloneSigHash, pStandAloneSigHash, NULL) == NULL)
+            {   // We won the initialization race
+                pStandAloneSigHash.SuppressRelease();
+            }
+        }
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::CreateStandAloneSigHash
+
+//---------------------------------------------------------------------------------------
+//
+// Add a new StandAloneSig to the hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::AddStandAloneSigToHash(
+    mdSignature sa)     // Token of new guy.
+{
+    HRESULT hr = S_OK;
+
+    // If the hash exists, we will add to it - requires write-lock
+    INDEBUG(Debug_CheckIsLockedForWrite();)
+
+    // If the hash table hasn't been built it, see if it should get faulted in.
+    if (m_pStandAloneSigHash == NULL)
+    {
+        IfFailGo(CreateStandAloneSigHash());
+    }
+    else
+    {
+        StandAloneSigRec * pStandAloneSig;
+        IfFailGo(GetStandAloneSigRecord(RidFromToken(sa), &pStandAloneSig));
+
+        PCCOR_SIGNATURE pvSigBlob;
+        ULONG           cbSigBlob;
+        IfFailGo(getSignatureOfStandAloneSig(pStandAloneSig, &pvSigBlob, &cbSigBlob));
+        ULONG iHash = HashSig(pvSigBlob, cbSigBlob);
+
+        TOKENHASHENTRY * pEntry = m_pStandAloneSigHash->Add(iHash);
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(RidFromToken(sa), mdtSignature);
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::AddStandAloneSigToHash
+
+//---------------------------------------------------------------------------------------
+//
+// If the hash is built, search for a StandAloneSig with the given signature.
+//
+CMiniMdRW::HashSearchResult
+CMiniMdRW::FindStandAloneSigFromHash(
+    PCCOR_SIGNATURE pvSigBlob,      // Signature.
+    ULONG           cbSigBlob,      // Size of signature.
+    mdSignature *   ptkSignature)   // OUT: Return if found.
+{
+    // If the table is there, look for the item in the chain of items.
+    if (m_pStandAloneSigHash != NULL)
+    {
+        TOKENHASHENTRY * p;
+        ULONG            iHash;
+        int              pos;
+
+        // Hash the data.
+        iHash = HashSig(pvSigBlob, cbSigBlob);
+
+        // Go through every entry in the hash chain looking for ours.
+        for (p = m_pStandAloneSigHash->FindFirst(iHash, pos);
+             p != NULL;
+             p = m_pStandAloneSigHash->FindNext(pos))
+        {
+            StandAloneSigRec * pStandAloneSig;
+            if (FAILED(GetStandAloneSigRecord(RidFromToken(p->tok), &pStandAloneSig)))
+                continue;
+
+            PCCOR_SIGNATURE pvSigBlobTmp;
+            ULONG           cbSigBlobTmp;
+            if (FAILED(getSignatureOfStandAloneSig(pStandAloneSig, &pvSigBlobTmp, &cbSigBlobTmp)))
+                continue;
+
+            if ((cbSigBlobTmp == cbSigBlob)
+                && (memcmp(pvSigBlob, pvSigBlobTmp, cbSigBlob) == 0))
+            {
+                *ptkSignature = p->tok;
+                return Found;
+            }
+        }
+
+        return NotFound;
+    }
+    else
+    {
+        return NoTable;
+    }
+} // CMiniMdRW::FindStandAloneSigFromHash
+
+//---------------------------------------------------------------------------------------
+//
+// Create MethodSpec hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::CreateMethodSpecHash()
+{
+    HRESULT hr = S_OK;
+
+    if (m_pMethodSpecHash == NULL)
+    {
+        ULONG ridEnd = getCountMethodSpecs();
+        if (ridEnd + 1 > INDEX_ROW_COUNT_THRESHOLD)
+        {
+            // Create a new hash.
+            NewHolder<CMetaDataHashBase> pMethodSpecHash = new (nothrow) CMetaDataHashBase();
+            IfNullGo(pMethodSpecHash);
+            IfFailGo(pMethodSpecHash->NewInit(
+                g_HashSize[GetMetaDataSizeIndex(&m_OptionValue)]));
+
+            // Scan every entry already in the table, add it to the hash.
+            for (ULONG index = 1; index <= ridEnd; index++)
+            {
+                MethodSpecRec * pMethodSpec;
+                IfFailGo(GetMethodSpecRecord(index, &pMethodSpec));
+
+                PCCOR_SIGNATURE pvSigBlob;
+                ULONG           cbSigBlob;
+                IfFailGo(getInstantiationOfMethodSpec(pMethodSpec, &pvSigBlob, &cbSigBlob));
+                ULONG iHash = HashToken(getMethodOfMethodSpec(pMethodSpec))
+                    + HashSig(pvSigBlob, cbSigBlob);
+
+                TOKENHASHENTRY * pEntry = pMethodSpecHash->Add(iHash);
+                IfNullGo(pEntry);
+                pEntry->tok = TokenFromRid(index, mdtMethodSpec);
+            }
+
+            if (InterlockedCompareExchangeT<CMetaDataHashBase *>(&m_pMethodSpecHash, pMethodSpecHash, NULL) == NULL)
+            {   // We won the initialization race
+                pMethodSpecHash.SuppressRelease();
+            }
+        }
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::CreateMethodSpecHash
+
+//---------------------------------------------------------------------------------------
+//
+// Add a new MethodSpec to the hash table.
+//
+__checkReturn
+HRESULT
+CMiniMdRW::AddMethodSpecToHash(
+    mdMethodSpec ms)    // Token of new guy.
+{
+    HRESULT hr = S_OK;
+
+    // If the hash exists, we will add to it - requires write-lock
+    INDEBUG(Debug_CheckIsLockedForWrite();)
+
+    // If the hash table hasn't been built it, see if it should get faulted in.
+    if (m_pMethodSpecHash == NULL)
+    {
+        IfFailGo(CreateMethodSpecHash());
+    }
+    else
+    {
+        MethodSpecRec * pMethodSpec;
+        IfFailGo(GetMethodSpecRecord(RidFromToken(ms), &pMethodSpec));
+
+        PCCOR_SIGNATURE pvSigBlob;
+        ULONG           cbSigBlob;
+        IfFailGo(getInstantiationOfMethodSpec(pMethodSpec, &pvSigBlob, &cbSigBlob));
+        ULONG iHash = HashToken(getMethodOfMethodSpec(pMethodSpec))
+            + HashSig(pvSigBlob, cbSigBlob);
+
+        TOKENHASHENTRY * pEntry = m_pMethodSpecHash->Add(iHash);
+        IfNullGo(pEntry);
+        pEntry->tok = TokenFromRid(RidFromToken(ms), mdtMethodSpec);
+    }
+
+ErrExit:
+    return hr;
+} // CMiniMdRW::AddMethodSpecToHash
+
+//---------------------------------------------------------------------------------------
+//
+// If the hash is built, search for a MethodSpec with the given method and
+// instantiation. Ignores the rid ridIgnore, if non-zero.
+//
+CMiniMdRW::HashSearchResult
+CMiniMdRW::FindMethodSpecFromHash(
+    mdToken         tkMethod,       // MethodSpec method field.
+    PCCOR_SIGNATURE pvSigBlob,      // Instantiation signature.
+    ULONG           cbSigBlob,      // Size of signature.
+    RID             ridIgnore,      // Optional rid to be ignored.
+    mdMethodSpec *  ptkMethodSpec)  // OUT: Return if found.
+{
+    // If the table is there, look for the item in the chain of items.
+    if (m_pMethodSpecHash != NULL)
+    {
+        TOKENHASHENTRY * p;
+        ULONG            iHash;
+        int              pos;
+
+        // Hash the data.
+        iHash = HashToken(tkMethod) + HashSig(pvSigBlob, cbSigBlob);
+
+        // Go through every entry in the hash chain looking for ours.
+        for (p = m_pMethodSpecHash->FindFirst(iHash, pos);
+             p != NULL;
+             p = m_pMethodSpecHash->FindNext(pos))
+        {
+            if (RidFromToken(p->tok) == ridIgnore)
+                continue;
+
+            MethodSpecRec * pMethodSpec;
+            if (FAILED(GetMethodSpecRecord(RidFromToken(p->tok), &pMethodSpec)))
+                continue;
+
+            if (getMethodOfMethodSpec(pMethodSpec) != tkMethod)
+                continue;
+
+            PCCOR_SIGNATURE pvSigBlobTmp;
+            ULONG           cbSigBlobTmp;
+            if (FAILED(getInstantiationOfMethodSpec(pMethodSpec, &pvSigBlobTmp, &cbSigBlobTmp)))
+                continue;
+
+            if ((cbSigBlobTmp == cbSigBlob)
+                && (memcmp(pvSigBlob, pvSigBlobTmp, cbSigBlob) == 0))
+            {
+                *ptkMethodSpec = p->tok;
+                return Found;
+            }
+        }
+
+        return NotFound;
+    }
+    else
+    {
+        return NoTable;
+    }
+} // CMiniMdRW::FindMethodSpecFromHash
+
 //*****************************************************************************
 // Check a given mr token to see if this one is a match.
 //*****************************************************************************
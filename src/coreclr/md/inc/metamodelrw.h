@@ -592,6 +592,54 @@ public:
         PCCOR_SIGNATURE pvSigBlob,          // Signature.
         ULONG       cbSigBlob);             // Size of signature.
 
+    // Create TypeSpec hash table.
+    __checkReturn
+    HRESULT CreateTypeSpecHash();
+
+    // Add a new TypeSpec to the hash table.
+    __checkReturn
+    HRESULT AddTypeSpecToHash(              // Return code.
+        mdTypeSpec ts);                     // Token of new TypeSpec.
+
+    // If the hash is built, search for a TypeSpec with the given signature.
+    HashSearchResult FindTypeSpecFromHash(
+        PCCOR_SIGNATURE pvSigBlob,      // Signature.
+        ULONG           cbSigBlob,      // Size of signature.
+        mdTypeSpec *    ptkTypeSpec);   // OUT: Return if found.
+
+    // Create StandAloneSig hash table.
+    __checkReturn
+    HRESULT CreateStandAloneSigHash();
+
+    // Add a new StandAloneSig to the hash table.
+    __checkReturn
+    HRESULT AddStandAloneSigToHash(         // Return code.
+        mdSignature sa);                    // Token of new StandAloneSig.
+
+    // If the hash is built, search for a StandAloneSig with the given signature.
+    HashSearchResult FindStandAloneSigFromHash(
+        PCCOR_SIGNATURE pvSigBlob,      // Signature.
+        ULONG           cbSigBlob,      // Size of signature.
+        mdSignature *   ptkSignature);  // OUT: Return if found.
+
+    // Create MethodSpec hash table.
+    __checkReturn
+    HRESULT CreateMethodSpecHash();
+
+    // Add a new MethodSpec to the hash table.
+    __checkReturn
+    HRESULT AddMethodSpecToHash(            // Return code.
+        mdMethodSpec ms);                   // Token of new MethodSpec.
+
+    // If the hash is built, search for a MethodSpec with the given method and
+    // instantiation. Ignores the rid ridIgnore, if non-zero.
+    HashSearchResult FindMethodSpecFromHash(
+        mdToken         tkMethod,       // MethodSpec method field.
+        PCCOR_SIGNATURE pvSigBlob,      // Instantiation signature.
+        ULONG           cbSigBlob,      // Size of signature.
+        RID             ridIgnore,      // Optional rid to be ignored.
+        mdMethodSpec *  ptkMethodSpec); // OUT: Return if found.
+
     // Add a new MemberDef to the hash table.
     __checkReturn
     HRESULT AddMemberDefToHash(
@@ -641,6 +689,11 @@ public:
         return HashMemberRef(tkPar, szName);
     }
 
+    inline ULONG HashSig(PCCOR_SIGNATURE pvSigBlob, ULONG cbSigBlob)
+    {
+        return HashBytes((const BYTE *) pvSigBlob, cbSigBlob);
+    }
+
     // helper to calculate the hash value given a token
     inline ULONG HashCustomAttribute(mdToken tkObject)
     {
@@ -653,6 +706,11 @@ public:
     // Hash table for Methods and Fields
     CMemberDefHash *m_pMemberDefHash;
 
+    // Hash tables for the signature-keyed duplicate searches done on the emit path.
+    CMetaDataHashBase *m_pTypeSpecHash;         // Hashed by signature.
+    CMetaDataHashBase *m_pStandAloneSigHash;    // Hashed by signature.
+    CMetaDataHashBase *m_pMethodSpecHash;       // Hashed by method token and instantiation.
+
     // helper to calculate the hash value given a pair of tokens
     inline ULONG HashToken(mdToken tkObject)
     {
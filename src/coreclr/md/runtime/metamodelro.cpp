@@ -259,12 +259,24 @@ CMiniMd::vSearchTable(
     // Start with entire table.
     lo = 1;
     hi = GetCountRecs(ixTbl);
+    if (lo > hi)
+    {   // Empty table.
+        *pRid = 0;
+        return S_OK;
+    }
+
+    // Read-only tables are a single contiguous chunk of fixed-size records,
+    // so resolve the first row once and address the probes directly instead
+    // of paying the getRow range check on every iteration.
+    IfFailRet(getRow(ixTbl, 1, &pRow));
+    const BYTE *pBase = (const BYTE *)pRow;
+    ULONG cbRec = m_TableDefs[ixTbl].m_cbRec;
+
     // While there are rows in the range...
     while (lo <= hi)
     {   // Look at the one in the middle.
         mid = (lo + hi) / 2;
-        IfFailRet(getRow(ixTbl, mid, &pRow));
-        val = getIX(pRow, sColumn);
+        val = getIX(pBase + ((ULONG)mid - 1) * cbRec, sColumn);
         // If equal to the target, done.
         if (val == ulTarget)
         {
@@ -313,12 +325,19 @@ CMiniMd::vSearchTableNotGreater(
         *pRid = 0;
         return S_OK;
     }
+
+    // Read-only tables are a single contiguous chunk of fixed-size records,
+    // so resolve the first row once and address the probes directly instead
+    // of paying the getRow range check on every iteration.
+    IfFailRet(getRow(ixTbl, 1, &pRow));
+    const BYTE *pBase = (const BYTE *)pRow;
+    ULONG cbRec = m_TableDefs[ixTbl].m_cbRec;
+
     // While there are rows in the range...
     while (lo <= hi)
     {   // Look at the one in the middle.
         mid = (lo + hi) / 2;
-        IfFailRet(getRow(ixTbl, mid, &pRow));
-        val = getIX(pRow, sColumn);
+        val = getIX(pBase + (mid - 1) * cbRec, sColumn);
         // If equal to the target, done searching.
         if (val == ulTarget)
             break;
@@ -342,8 +361,7 @@ CMiniMd::vSearchTableNotGreater(
             // If there is nothing else to look at, we won't find it.
             if (--mid < 1)
                 break;
-            IfFailRet(getRow(ixTbl, mid, &pRow));
-            val = getIX(pRow, sColumn);
+            val = getIX(pBase + (mid - 1) * cbRec, sColumn);
         }
     }
     else
@@ -353,8 +371,7 @@ CMiniMd::vSearchTableNotGreater(
         while (mid < cRecs)
         {
             // There is another record.  Get its value.
-            IfFailRet(getRow(ixTbl, mid+1, &pRow));
-            val = getIX(pRow, sColumn);
+            val = getIX(pBase + mid * cbRec, sColumn);
             // If that record is too high, stop.
             if (val > ulTarget)
                 break;
@@ -317,15 +317,20 @@ static uintptr_t AllocateCache(uint32_t cCacheEntries, InterfaceDispatchCache *
     pCache->m_cEntries = cCacheEntries;
     pCache->m_cacheHeader.Initialize(pNewCellInfo);
 
-    // Copy over entries from previous version of the cache (if any) and zero the rest.
+    // Copy over entries from previous version of the cache (if any) and zero the rest. The copied
+    // entries are shifted down by one slot: slot zero is reserved for the entry that caused the cache
+    // to grow. The dispatch stubs probe entries in order, so the type that just missed (and is the
+    // likely receiver from now on) gets the first type guard, which keeps dispatch for cells that
+    // settle on a single receiver type after a polymorphic phase as cheap as the monomorphic cache.
     if (pExistingCache)
     {
-        memcpy(pCache->m_rgEntries,
+        memset(&pCache->m_rgEntries[0], 0, sizeof(InterfaceDispatchCacheEntry));
+        memcpy(&pCache->m_rgEntries[1],
                pExistingCache->m_rgEntries,
                sizeof(InterfaceDispatchCacheEntry) * pExistingCache->m_cEntries);
-        memset(&pCache->m_rgEntries[pExistingCache->m_cEntries],
+        memset(&pCache->m_rgEntries[pExistingCache->m_cEntries + 1],
                0,
-               (cCacheEntries - pExistingCache->m_cEntries) * sizeof(InterfaceDispatchCacheEntry));
+               (cCacheEntries - pExistingCache->m_cEntries - 1) * sizeof(InterfaceDispatchCacheEntry));
     }
     else
     {
@@ -500,8 +505,11 @@ FCIMPL4(PCODE, RhpUpdateDispatchCellCache, InterfaceDispatchCell * pCell, PCODE
         pCache->m_pCell = pCell;
 #endif // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 
-        // Add entry to the first unused slot.
-        InterfaceDispatchCacheEntry * pCacheEntry = &pCache->m_rgEntries[cOldCacheEntries];
+        // Add the entry to the first slot, where the stub's first type guard will hit for it. The
+        // cache hasn't been published yet so it's safe to write the entry directly. For a grown
+        // cache the old entries were copied starting at slot one, so the unused slots (if any) are
+        // still the trailing ones.
+        InterfaceDispatchCacheEntry * pCacheEntry = &pCache->m_rgEntries[0];
         pCacheEntry->m_pInstanceType = pInstanceType;
         pCacheEntry->m_pTargetCode = pTargetCode;
     }
@@ -31,6 +31,12 @@ static_assert((THUNK_SIZE % 4) == 0, "Thunk stubs size not aligned correctly. Th
 // 32 K or OS page
 #define THUNKS_MAP_SIZE (max(0x8000, OS_PAGE_SIZE))
 
+// Number of stub/data section pairs reserved per thunk arena. Carving the mappings out
+// of one contiguous reservation keeps the thunk stubs adjacent in the address space
+// instead of scattered wherever the OS places each allocation, and makes growing the
+// thunk pool a bump within the arena rather than a fresh allocation per mapping.
+#define THUNKS_ARENA_MAPPING_COUNT 16
+
 #ifdef TARGET_ARM
 //*****************************************************************************
 //  Encode a 16-bit immediate mov/movt in ARM Thumb2 Instruction (format T2_N)
@@ -98,33 +104,45 @@ FCIMPLEND
 
 EXTERN_C void* QCALLTYPE RhAllocateThunksMapping()
 {
+    // Calls to this helper are serialized by the managed thunk pool, so plain statics
+    // are sufficient here, as in the other thunk allocation flavors below.
+    static uint8_t* s_pThunksArena = NULL;
+    static int s_thunksArenaMappingsUsed = THUNKS_ARENA_MAPPING_COUNT;
+
+    if (s_thunksArenaMappingsUsed == THUNKS_ARENA_MAPPING_COUNT)
+    {
 #ifdef WIN32
+        s_pThunksArena = (uint8_t*)VirtualAlloc(NULL, (size_t)THUNKS_MAP_SIZE * 2 * THUNKS_ARENA_MAPPING_COUNT, MEM_RESERVE, PAGE_READWRITE);
+#else
+        // Note: On secure linux systems, we can't add execute permissions to a mapped virtual memory if it was not created
+        // with execute permissions in the first place. This is why we create the virtual section with RX permissions, then
+        // reduce it to RW for the data section. For the stubs section we need to increase to RWX to generate the stubs
+        // instructions. After this we go back to RX for the stubs section before the stubs are used and should not be
+        // changed anymore. The pages of the arena beyond the current mapping stay untouched, and thus uncommitted,
+        // until the pool grows into them.
+        s_pThunksArena = (uint8_t*)PalVirtualAlloc((size_t)THUNKS_MAP_SIZE * 2 * THUNKS_ARENA_MAPPING_COUNT, PAGE_EXECUTE_READ);
+#endif
+        if (s_pThunksArena == NULL)
+            return NULL;
 
-    void * pNewMapping = PalVirtualAlloc(THUNKS_MAP_SIZE * 2, PAGE_READWRITE);
-    if (pNewMapping == NULL)
-        return NULL;
+        s_thunksArenaMappingsUsed = 0;
+    }
+
+    uint8_t* pNewMapping = s_pThunksArena + (size_t)s_thunksArenaMappingsUsed * (THUNKS_MAP_SIZE * 2);
 
     void * pThunksSection = pNewMapping;
-    void * pDataSection = (uint8_t*)pNewMapping + THUNKS_MAP_SIZE;
+    void * pDataSection = pNewMapping + THUNKS_MAP_SIZE;
 
-#else
+#ifdef WIN32
 
-    // Note: On secure linux systems, we can't add execute permissions to a mapped virtual memory if it was not created
-    // with execute permissions in the first place. This is why we create the virtual section with RX permissions, then
-    // reduce it to RW for the data section. For the stubs section we need to increase to RWX to generate the stubs
-    // instructions. After this we go back to RX for the stubs section before the stubs are used and should not be
-    // changed anymore.
-    void * pNewMapping = PalVirtualAlloc(THUNKS_MAP_SIZE * 2, PAGE_EXECUTE_READ);
-    if (pNewMapping == NULL)
+    if (VirtualAlloc(pNewMapping, THUNKS_MAP_SIZE * 2, MEM_COMMIT, PAGE_READWRITE) == NULL)
         return NULL;
 
-    void * pThunksSection = pNewMapping;
-    void * pDataSection = (uint8_t*)pNewMapping + THUNKS_MAP_SIZE;
+#else
 
     if (!PalVirtualProtect(pDataSection, THUNKS_MAP_SIZE, PAGE_READWRITE) ||
         !PalVirtualProtect(pThunksSection, THUNKS_MAP_SIZE, PAGE_EXECUTE_READWRITE))
     {
-        PalVirtualFree(pNewMapping, THUNKS_MAP_SIZE * 2);
         return NULL;
     }
 
@@ -250,13 +268,14 @@ EXTERN_C void* QCALLTYPE RhAllocateThunksMapping()
 #else
     if (!PalVirtualProtect(pThunksSection, THUNKS_MAP_SIZE, PAGE_EXECUTE_READ))
     {
-        PalVirtualFree(pNewMapping, THUNKS_MAP_SIZE * 2);
         return NULL;
     }
 #endif
 
     PalFlushInstructionCache(pThunksSection, THUNKS_MAP_SIZE);
 
+    s_thunksArenaMappingsUsed++;
+
     return pThunksSection;
 }
 
@@ -55,15 +55,28 @@ void * TypeManager::GetModuleSection(ReadyToRunSectionType sectionId, int * leng
 
     ASSERT(m_pHeader->EntrySize == sizeof(ModuleInfoRow));
 
-    // TODO: Binary search
-    for (int i = 0; i < m_pHeader->NumberOfSections; i++)
+    // The compiler emits the section table sorted by section id, so it can be
+    // consumed in place as a binary-searchable index.
+    int lo = 0;
+    int hi = m_pHeader->NumberOfSections - 1;
+    while (lo <= hi)
     {
-        ModuleInfoRow * pCurrent = pModuleInfoRows + i;
+        int mid = lo + ((hi - lo) >> 1);
+        ModuleInfoRow * pCurrent = pModuleInfoRows + mid;
+        ASSERT((mid == 0) || ((pCurrent - 1)->SectionId < pCurrent->SectionId));
         if ((int32_t)sectionId == pCurrent->SectionId)
         {
             *length = pCurrent->GetLength();
             return pCurrent->Start;
         }
+        else if ((int32_t)sectionId < pCurrent->SectionId)
+        {
+            hi = mid - 1;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
     }
 
     *length = 0;
@@ -270,28 +270,72 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
     int remaining = 0;
     bool observeOnly = false;
 
+    // The thread list cannot change while we hold the threadstore lock, so count the attached
+    // threads and size a scratch array for tracking the ones that have not reached a safe point
+    // yet. The retry passes below then only revisit those stragglers, so the cost of waiting for
+    // the last few threads does not scale with the total number of attached threads. If the
+    // allocation fails we fall back to rescanning the whole list on every pass.
+    int cMaxThreads = 0;
+    FOREACH_THREAD(pTargetThread)
+    {
+        cMaxThreads++;
+    }
+    END_FOREACH_THREAD
+
+    NewArrayHolder<Thread*> pPendingThreads = new (nothrow) Thread*[cMaxThreads];
+    int cPendingThreads = -1; // -1 until the first full pass has populated the array
+
     while(true)
     {
         prevRemaining = remaining;
         remaining = 0;
 
-        FOREACH_THREAD(pTargetThread)
+        if (cPendingThreads >= 0)
         {
-            if (pTargetThread == pThisThread)
-                continue;
-
-            if (!pTargetThread->CacheTransitionFrameForSuspend())
+            for (int i = 0; i < cPendingThreads; i++)
             {
-                remaining++;
-#ifdef FEATURE_HIJACK
-                if (!observeOnly)
+                Thread * pTargetThread = pPendingThreads[i];
+
+                if (!pTargetThread->CacheTransitionFrameForSuspend())
                 {
-                    pTargetThread->Hijack();
+                    pPendingThreads[remaining] = pTargetThread;
+                    remaining++;
+#ifdef FEATURE_HIJACK
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
+#endif // FEATURE_HIJACK
                 }
+            }
+
+            cPendingThreads = remaining;
+        }
+        else
+        {
+            FOREACH_THREAD(pTargetThread)
+            {
+                if (pTargetThread == pThisThread)
+                    continue;
+
+                if (!pTargetThread->CacheTransitionFrameForSuspend())
+                {
+                    if (pPendingThreads != NULL)
+                        pPendingThreads[remaining] = pTargetThread;
+                    remaining++;
+#ifdef FEATURE_HIJACK
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
 #endif // FEATURE_HIJACK
+                }
             }
+            END_FOREACH_THREAD
+
+            if (pPendingThreads != NULL)
+                cPendingThreads = remaining;
         }
-        END_FOREACH_THREAD
 
         if (!remaining)
             break;
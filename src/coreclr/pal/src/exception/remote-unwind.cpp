@@ -2235,17 +2235,26 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
     int phnum = ehdr.e_phnum;
     TRACE("ELF: base %p ip %p e_type %d e_phnum %d e_phoff %p\n", info->BaseAddress, ip, ehdr.e_type, ehdr.e_phnum, ehdr.e_phoff);
 
+    // Read the whole program header table with one remote read. This function runs for
+    // every frame of an out-of-process walk and each ReadMemory is a cross-process read,
+    // so reading the headers one at a time dominates the cost of finding the unwind info.
+    Phdr* phdrs = (Phdr*)malloc(phnum * sizeof(Phdr));
+    if (phdrs == nullptr) {
+        ERROR("Failed to allocate %d program headers\n", phnum);
+        return -UNW_EINVAL;
+    }
+    if (!info->ReadMemory(phdrAddr, phdrs, phnum * sizeof(Phdr))) {
+        ERROR("ELF: reading phdrAddr %p\n", phdrAddr);
+        free(phdrs);
+        return -UNW_EINVAL;
+    }
+
     unw_word_t loadbias = info->BaseAddress;
     for (int i = 0; i < phnum; i++)
     {
-        Phdr ph;
-        if (!info->ReadMemory(phdrAddr + i, &ph, sizeof(ph))) {
-            ERROR("ELF: reading phdrAddr %p\n", phdrAddr + i);
-            return -UNW_EINVAL;
-        }
-        if (ph.p_type == PT_LOAD && ph.p_offset == 0)
+        if (phdrs[i].p_type == PT_LOAD && phdrs[i].p_offset == 0)
         {
-            loadbias -= ph.p_vaddr;
+            loadbias -= phdrs[i].p_vaddr;
             TRACE("PHDR: loadbias %p\n", loadbias);
             break;
         }
@@ -2264,16 +2273,13 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
 
     // Search for the module's dynamic header and unwind frames
     Dyn* dynamicAddr = nullptr;
+    unw_word_t dynamicSize = 0;
 
-    for (int i = 0; i < phnum; i++, phdrAddr++)
+    for (int i = 0; i < phnum; i++)
     {
-        Phdr ph;
-        if (!info->ReadMemory(phdrAddr, &ph, sizeof(ph))) {
-            ERROR("ELF: reading phdrAddr %p\n", phdrAddr);
-            return -UNW_EINVAL;
-        }
+        const Phdr& ph = phdrs[i];
         TRACE("ELF: phdr %p type %d (%x) vaddr %" PRIxA " memsz %" PRIxA " paddr %" PRIxA " filesz %" PRIxA " offset %" PRIxA " align %" PRIxA "\n",
-            phdrAddr, ph.p_type, ph.p_type, ph.p_vaddr, ph.p_memsz, ph.p_paddr, ph.p_filesz, ph.p_offset, ph.p_align);
+            phdrAddr + i, ph.p_type, ph.p_type, ph.p_vaddr, ph.p_memsz, ph.p_paddr, ph.p_filesz, ph.p_offset, ph.p_align);
 
         switch (ph.p_type)
         {
@@ -2287,6 +2293,7 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
 
         case PT_DYNAMIC:
             dynamicAddr = reinterpret_cast<Dyn*>(loadbias + ph.p_vaddr);
+            dynamicSize = ph.p_memsz;
             break;
 
         case PT_GNU_EH_FRAME:
@@ -2306,25 +2313,35 @@ find_proc_info(unw_addr_space_t as, unw_word_t ip, unw_proc_info_t *pip, int nee
         }
     }
 
-    if (dynamicAddr != nullptr)
+    free(phdrs);
+
+    if (dynamicAddr != nullptr && dynamicSize != 0)
     {
-        while (true)
+        // The dynamic section size comes from the program header, so it can be read with
+        // a single remote read instead of one read per entry.
+        int dynCount = (int)(dynamicSize / sizeof(Dyn));
+        Dyn* dyns = (Dyn*)malloc(dynCount * sizeof(Dyn));
+        if (dyns == nullptr) {
+            ERROR("Failed to allocate %d dynamic entries\n", dynCount);
+            return -UNW_EINVAL;
+        }
+        if (!info->ReadMemory(dynamicAddr, dyns, dynCount * sizeof(Dyn))) {
+            ERROR("ELF: reading dynamicAddr %p\n", dynamicAddr);
+            free(dyns);
+            return -UNW_EINVAL;
+        }
+        for (int i = 0; i < dynCount; i++)
         {
-            Dyn dyn;
-            if (!info->ReadMemory(dynamicAddr, &dyn, sizeof(dyn))) {
-                ERROR("ELF: reading dynamicAddr %p\n", dynamicAddr);
-                return -UNW_EINVAL;
-            }
-            if (dyn.d_tag == DT_PLTGOT) {
-                TRACE("ELF: dyn %p tag %d (%x) d_ptr %p\n", dynamicAddr, dyn.d_tag, dyn.d_tag, dyn.d_un.d_ptr);
-                pip->gp = dyn.d_un.d_ptr;
+            if (dyns[i].d_tag == DT_PLTGOT) {
+                TRACE("ELF: dyn %p tag %d (%x) d_ptr %p\n", dynamicAddr + i, dyns[i].d_tag, dyns[i].d_tag, dyns[i].d_un.d_ptr);
+                pip->gp = dyns[i].d_un.d_ptr;
                 break;
             }
-            else if (dyn.d_tag == DT_NULL) {
+            else if (dyns[i].d_tag == DT_NULL) {
                 break;
             }
-            dynamicAddr++;
         }
+        free(dyns);
     }
 
 #ifdef FEATURE_USE_SYSTEM_LIBUNWIND
@@ -25,8 +25,9 @@ MethodContext::MethodContext()
 #define LWM(map, key, value) map = nullptr;
 #include "lwmlist.h"
 
-    cr    = new CompileResult();
-    index = -1;
+    cr         = new CompileResult();
+    originalCR = nullptr;
+    index      = -1;
     ignoreStoredConfig = false;
 }
 
@@ -42,6 +43,8 @@ void MethodContext::Destroy()
         delete map;
 #include "lwmlist.h"
 
+    if (originalCR != cr)
+        delete originalCR;
     delete cr;
     FreeTempAllocations();
 }
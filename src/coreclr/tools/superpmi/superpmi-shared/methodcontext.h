@@ -910,7 +910,10 @@ public:
 
     void Reset()
     {
+        if (originalCR != cr)
+            delete originalCR;
         delete cr;
+        originalCR = nullptr;
         FreeTempAllocations();
         cr = new CompileResult();
     }
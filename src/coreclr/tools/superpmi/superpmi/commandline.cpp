@@ -126,6 +126,12 @@ void CommandLine::DumpHelp(const char* program)
     printf("     Number of times compilation should repeat for each method context. Usually used when\n");
     printf("     trying to measure JIT throughput for a specific set of methods. Default=1.\n");
     printf("\n");
+    printf(" -tpDiffLimit <percent>\n");
+    printf("     When replaying with two JITs, compare the total number of instructions retired\n");
+    printf("     by each JIT and exit with code 4 if the second JIT retired more than 'percent'\n");
+    printf("     percent additional instructions (e.g., 0.5 allows up to a 0.5%% regression).\n");
+    printf("     Requires instruction count instrumentation to be available on the platform.\n");
+    printf("\n");
     printf(" -target <target>\n");
     printf("     Used by the assembly differences calculator. This specifies the target\n");
     printf("     architecture for cross-compilation. Currently allowed <target> values: x64, x86, arm, arm64\n");
@@ -165,6 +171,7 @@ void CommandLine::DumpHelp(const char* program)
     printf("1  : there were compilation failures\n");
     printf("2  : there were assembly diffs\n");
     printf("3  : there were missing values in method context\n");
+    printf("4  : the instructions retired regression exceeded the -tpDiffLimit threshold\n");
     printf("\n");
     printf("Examples:\n");
     printf(" %s " MAKEDLLNAME_A("clrjit") " test.mch\n", program);
@@ -580,6 +587,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                     return false;
                 }
             }
+            else if ((_stricmp(&argv[i][1], "tpDiffLimit") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->tpDiffLimit = atof(argv[i]);
+
+                if (o->tpDiffLimit < 0)
+                {
+                    LogError("Incorrect limit specified for -tpDiffLimit. Limit must be >= 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_strnicmp(&argv[i][1], "stride", argLen) == 0))
             {
                 // "-stride" is an internal switch used by -parallel. Usage is:
@@ -349,6 +349,11 @@ int __cdecl main(int argc, char* argv[])
     int index             = 0;
     int excludedCount     = 0;
 
+    // Total instructions retired by each JIT across all successfully replayed methods,
+    // used for the -tpDiffLimit throughput gate.
+    uint64_t totalBaseInstructions = 0;
+    uint64_t totalDiffInstructions = 0;
+
     st1.Start();
     NearDiffer nearDiffer(o.targetArchitecture, o.useCoreDisTools);
 
@@ -414,6 +419,7 @@ int __cdecl main(int argc, char* argv[])
             excludedCount++;
             LogInfo("main method %d of size %d with was excluded from the compilation.",
                     reader->GetMethodContextIndex(), mc->methodSize);
+            delete mc;
             continue;
         }
 
@@ -447,7 +453,12 @@ int __cdecl main(int argc, char* argv[])
             }
 
             // Create a new CompileResult for this compilation (the CompileResult from the stored file is
-            // in originalCR if necessary).
+            // in originalCR if necessary). On repeat iterations, free the result of the previous
+            // compilation first; without this a long replay accumulates every per-iteration result.
+            if (mc->cr != mc->originalCR)
+            {
+                delete mc->cr;
+            }
             mc->cr = new CompileResult();
 
             // For asm diffs, we need to store away the CompileResult generated by the first JIT when compiling
@@ -559,6 +570,12 @@ int __cdecl main(int argc, char* argv[])
 
             if ((res.Result == ReplayResult::Success) && (res2.Result == ReplayResult::Success))
             {
+                if (o.nameOfJit2 != nullptr)
+                {
+                    totalBaseInstructions += res.NumExecutedInstructions;
+                    totalDiffInstructions += res2.NumExecutedInstructions;
+                }
+
                 if (collectThroughput)
                 {
                     if ((o.nameOfJit2 != nullptr) && (res2.Result == ReplayResult::Success))
@@ -797,6 +814,21 @@ doneRepeatCount:
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
+    bool tpRegression = false;
+    if ((o.tpDiffLimit >= 0) && (o.nameOfJit2 != nullptr) && (totalBaseInstructions > 0))
+    {
+        double tpDelta =
+            ((double)totalDiffInstructions - (double)totalBaseInstructions) * 100.0 / (double)totalBaseInstructions;
+        LogInfo("Total instructions retired: base %llu, diff %llu (%+.4f%%)",
+                (unsigned long long)totalBaseInstructions, (unsigned long long)totalDiffInstructions, tpDelta);
+        if (tpDelta > o.tpDiffLimit)
+        {
+            LogError("Instructions retired regressed by %.4f%%, exceeding the limit of %.4f%%", tpDelta,
+                     o.tpDiffLimit);
+            tpRegression = true;
+        }
+    }
+
     if (methodStatsEmitter != nullptr)
     {
         delete methodStatsEmitter;
@@ -822,6 +854,10 @@ doneRepeatCount:
     {
         result = SpmiResult::Misses;
     }
+    else if (tpRegression)
+    {
+        result = SpmiResult::TpRegression;
+    }
 
     return (int)result;
 }
@@ -19,7 +19,8 @@ enum class SpmiResult
     Success         = 0,
     Error           = 1,
     Diffs           = 2,
-    Misses          = 3
+    Misses          = 3,
+    TpRegression    = 4
 };
 
 extern void SetSuperPmiTargetArchitecture(const char* targetArchitecture);
@@ -20,13 +20,14 @@ bool ExecutableAllocator::g_isWXorXEnabled = false;
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
 
-#ifndef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-#define EXECUTABLE_ALLOCATOR_CACHE_SIZE ARRAY_SIZE(m_cachedMapping)
-#else
+// Default number of entries of the RW mapping cache that are used. It can be
+// overridden up to ARRAY_SIZE(m_cachedMapping) using the
+// EXECUTABLE_ALLOCATOR_CACHE_SIZE environment variable.
+#define EXECUTABLE_ALLOCATOR_DEFAULT_CACHE_SIZE 8
+
 int ExecutableAllocator::g_cachedMappingSize = 0;
 
 #define EXECUTABLE_ALLOCATOR_CACHE_SIZE ExecutableAllocator::g_cachedMappingSize
-#endif
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
 int64_t ExecutableAllocator::g_mapTimeSum = 0;
@@ -241,8 +242,7 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
 {
     LIMITED_METHOD_CONTRACT;
 
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    g_cachedMappingSize = ARRAY_SIZE(m_cachedMapping);
+    g_cachedMappingSize = EXECUTABLE_ALLOCATOR_DEFAULT_CACHE_SIZE;
     auto envString = getenv("EXECUTABLE_ALLOCATOR_CACHE_SIZE");
     if (envString != NULL)
     {
@@ -258,7 +258,6 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
             g_cachedMappingSize = customCacheSize;
         }
     }
-#endif
 
     g_fatalErrorHandler = fatalErrorHandler;
     g_isWXorXEnabled = Configuration::GetKnobBooleanValue(W("System.Runtime.EnableWriteXorExecute"), CLRConfig::EXTERNAL_EnableWriteXorExecute);
@@ -310,17 +309,10 @@ void ExecutableAllocator::RemoveCachedMapping(size_t index)
     if (cachedMapping == NULL)
         return;
 
-    void* unmapAddress = NULL;
-    size_t unmapSize;
-
-    if (!RemoveRWBlock(cachedMapping->baseRW, &unmapAddress, &unmapSize))
+    if (!RemoveRWBlock(cachedMapping->baseRW))
     {
         g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
     }
-    if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
-    {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
-    }
 
     m_cachedMapping[index - 1] = NULL;
 #endif // ENABLE_CACHED_MAPPINGS
@@ -418,7 +410,7 @@ bool ExecutableAllocator::AddRWBlock(void* baseRW, void* baseRX, size_t size, Ca
     return true;
 }
 
-bool ExecutableAllocator::RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t* pUnmapSize)
+bool ExecutableAllocator::RemoveRWBlock(void* pRW)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -431,7 +423,6 @@ bool ExecutableAllocator::RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t*
             pBlockRW->refCount--;
             if (pBlockRW->refCount != 0)
             {
-                *pUnmapAddress = NULL;
                 return true;
             }
 
@@ -444,10 +435,9 @@ bool ExecutableAllocator::RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t*
                 pPrevBlockRW->next = pBlockRW->next;
             }
 
-            *pUnmapAddress = pBlockRW->baseRW;
-            *pUnmapSize = pBlockRW->size;
-
-            delete pBlockRW;
+            // Defer the actual unmapping until the critical section is left
+            pBlockRW->next = m_pFirstPendingUnmapRW;
+            m_pFirstPendingUnmapRW = pBlockRW;
             return true;
         }
 
@@ -457,6 +447,31 @@ bool ExecutableAllocator::RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t*
     return false;
 }
 
+ExecutableAllocator::BlockRW* ExecutableAllocator::DetachPendingUnmapList()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    BlockRW* pList = m_pFirstPendingUnmapRW;
+    m_pFirstPendingUnmapRW = NULL;
+    return pList;
+}
+
+void ExecutableAllocator::ReleasePendingUnmapList(BlockRW* pList)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (pList != NULL)
+    {
+        BlockRW* pNext = pList->next;
+        if (!VMToOSInterface::ReleaseRWMapping(pList->baseRW, pList->size))
+        {
+            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+        }
+        delete pList;
+        pList = pNext;
+    }
+}
+
 bool ExecutableAllocator::AllocateOffset(size_t* pOffset, size_t size)
 {
     LIMITED_METHOD_CONTRACT;
@@ -548,6 +563,11 @@ void ExecutableAllocator::Release(void* pRX)
                 cachedMappingThatOverlaps = FindOverlappingCachedMapping(pBlock);
             }
 
+            // Unmap the overlapping RW views right away, before the underlying
+            // memory is released. Release is rare enough that doing the OS calls
+            // under the critical section doesn't matter here.
+            ReleasePendingUnmapList(DetachPendingUnmapList());
+
             if (!VMToOSInterface::ReleaseDoubleMappedMemory(m_doubleMemoryMapperHandle, pRX, pBlock->offset, pBlock->size))
             {
                 g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the double mapped memory failed"));
@@ -857,74 +877,108 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
     StopWatch swAll(&g_mapTimeWithLockSum);
 #endif
 
-    CRITSEC_Holder csh(m_CriticalSection);
+    void* result = NULL;
+    BlockRW* pPendingUnmapList = NULL;
+
+    {
+        CRITSEC_Holder csh(m_CriticalSection);
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-    ExecutableAllocator::g_MapRW_Calls++;
+        ExecutableAllocator::g_MapRW_Calls++;
 #endif
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-    StopWatch sw(&g_mapTimeSum);
+        StopWatch sw(&g_mapTimeSum);
 #endif
 
-    void* result = FindRWBlock(pRX, size, cacheMapping);
-    if (result != NULL)
-    {
-        return result;
-    }
+        result = FindRWBlock(pRX, size, cacheMapping);
+        if (result == NULL)
+        {
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-    StopWatch sw2(&g_mapFindRXTimeSum);
+            StopWatch sw2(&g_mapFindRXTimeSum);
 #endif
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-    ExecutableAllocator::g_MapRW_CallsWithCacheMiss++;
+            ExecutableAllocator::g_MapRW_CallsWithCacheMiss++;
 #endif
 
-    for (BlockRX** ppBlock = &m_pFirstBlockRX; *ppBlock != NULL; ppBlock = &((*ppBlock)->next))
-    {
-        BlockRX* pBlock = *ppBlock;
+            for (BlockRX** ppBlock = &m_pFirstBlockRX; *ppBlock != NULL; ppBlock = &((*ppBlock)->next))
+            {
+                BlockRX* pBlock = *ppBlock;
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-        ExecutableAllocator::g_MapRW_LinkedListWalkDepth++;
+                ExecutableAllocator::g_MapRW_LinkedListWalkDepth++;
 #endif
-        if (pRX >= pBlock->baseRX && ((size_t)pRX + size) <= ((size_t)pBlock->baseRX + pBlock->size))
-        {
-            // Move found block to the front of the singly linked list
-            *ppBlock = pBlock->next;
-            pBlock->next = m_pFirstBlockRX;
-            m_pFirstBlockRX = pBlock;
-
-            // Offset of the RX address in the originally allocated block
-            size_t offset = (size_t)pRX - (size_t)pBlock->baseRX;
-            // Offset of the RX address that will start the newly mapped block
-            size_t mapOffset = ALIGN_DOWN(offset, Granularity());
-            // Size of the block we will map
-            size_t mapSize = ALIGN_UP(offset - mapOffset + size, Granularity());
+                if (pRX >= pBlock->baseRX && ((size_t)pRX + size) <= ((size_t)pBlock->baseRX + pBlock->size))
+                {
+                    // Move found block to the front of the singly linked list
+                    *ppBlock = pBlock->next;
+                    pBlock->next = m_pFirstBlockRX;
+                    m_pFirstBlockRX = pBlock;
+
+                    // Offset of the RX address in the originally allocated block
+                    size_t offset = (size_t)pRX - (size_t)pBlock->baseRX;
+                    // Offset of the RX address that will start the newly mapped block
+                    size_t mapOffset = ALIGN_DOWN(offset, Granularity());
+                    // Size of the block we will map
+                    size_t mapSize = ALIGN_UP(offset - mapOffset + size, Granularity());
+
+                    // For mappings that are going to be cached, map ahead of the requested
+                    // range up to the end of the RX block so that writes to stubs allocated
+                    // right after this one are satisfied by the same mapping instead of
+                    // paying for another mmap / munmap pair.
+                    if (cacheMapping == AddToCache)
+                    {
+                        size_t maxMapSize = pBlock->size - mapOffset;
+                        size_t mapAheadSize = mapSize + 4 * Granularity();
+                        if (mapAheadSize > maxMapSize)
+                        {
+                            mapAheadSize = maxMapSize;
+                        }
+                        if (mapAheadSize > mapSize)
+                        {
+                            mapSize = mapAheadSize;
+                        }
+                    }
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-            StopWatch sw2(&g_mapCreateTimeSum);
+                    StopWatch sw2(&g_mapCreateTimeSum);
 #endif
-            void* pRW = VMToOSInterface::GetRWMapping(m_doubleMemoryMapperHandle, (BYTE*)pBlock->baseRX + mapOffset, pBlock->offset + mapOffset, mapSize);
+                    void* pRW = VMToOSInterface::GetRWMapping(m_doubleMemoryMapperHandle, (BYTE*)pBlock->baseRX + mapOffset, pBlock->offset + mapOffset, mapSize);
 
-            if (pRW == NULL)
-            {
-                g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Failed to create RW mapping for RX memory. This can be caused by insufficient memory or hitting the limit of memory mappings on Linux (vm.map_max_count)."));
-            }
+                    if (pRW == NULL)
+                    {
+                        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Failed to create RW mapping for RX memory. This can be caused by insufficient memory or hitting the limit of memory mappings on Linux (vm.map_max_count)."));
+                    }
 
-            AddRWBlock(pRW, (BYTE*)pBlock->baseRX + mapOffset, mapSize, cacheMapping);
+                    AddRWBlock(pRW, (BYTE*)pBlock->baseRX + mapOffset, mapSize, cacheMapping);
 
-            return (void*)((size_t)pRW + (offset - mapOffset));
-        }
-        else if (pRX >= pBlock->baseRX && pRX < (void*)((size_t)pBlock->baseRX + pBlock->size))
-        {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Attempting to RW map a block that crosses the end of the allocated RX range"));
-        }
-        else if (pRX < pBlock->baseRX && (void*)((size_t)pRX + size) > pBlock->baseRX)
-        {
-            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Attempting to map a block that crosses the beginning of the allocated range"));
+                    result = (void*)((size_t)pRW + (offset - mapOffset));
+                    break;
+                }
+                else if (pRX >= pBlock->baseRX && pRX < (void*)((size_t)pBlock->baseRX + pBlock->size))
+                {
+                    g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Attempting to RW map a block that crosses the end of the allocated RX range"));
+                }
+                else if (pRX < pBlock->baseRX && (void*)((size_t)pRX + size) > pBlock->baseRX)
+                {
+                    g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Attempting to map a block that crosses the beginning of the allocated range"));
+                }
+            }
+
+            if (result == NULL)
+            {
+                // The executable memory block was not found, so we cannot provide the writeable mapping.
+                g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RX block to map as RW was not found"));
+                return NULL;
+            }
         }
+
+        pPendingUnmapList = DetachPendingUnmapList();
     }
 
-    // The executable memory block was not found, so we cannot provide the writeable mapping.
-    g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RX block to map as RW was not found"));
-    return NULL;
+    // Unmap the mappings evicted from the cache above only after the critical
+    // section was left so that the OS calls don't block other threads.
+    ReleasePendingUnmapList(pPendingUnmapList);
+
+    return result;
 }
 
 // Unmap writeable mapping at the specified address. The address must be an address
@@ -942,23 +996,25 @@ void ExecutableAllocator::UnmapRW(void* pRW)
         return;
     }
 
-    CRITSEC_Holder csh(m_CriticalSection);
-    _ASSERTE(pRW != NULL);
+    BlockRW* pPendingUnmapList = NULL;
 
-#ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
-    StopWatch swNoLock(&g_unmapTimeSum);
-#endif
+    {
+        CRITSEC_Holder csh(m_CriticalSection);
+        _ASSERTE(pRW != NULL);
 
-    void* unmapAddress = NULL;
-    size_t unmapSize;
+        if (!RemoveRWBlock(pRW))
+        {
+            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
+        }
 
-    if (!RemoveRWBlock(pRW, &unmapAddress, &unmapSize))
-    {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
+        pPendingUnmapList = DetachPendingUnmapList();
     }
 
-    if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
-    {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
-    }
+#ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
+    StopWatch swNoLock(&g_unmapTimeSum);
+#endif
+
+    // Release the mapping (if its refcount dropped to zero) outside of the
+    // critical section so that the OS calls don't block other threads.
+    ReleasePendingUnmapList(pPendingUnmapList);
 }
@@ -11,6 +11,7 @@
 #include "ex.h"
 #include "holder.h"
 #include <minipal/strings.h>
+#include <minipal/utf8.h>
 
 #if defined(_MSC_VER)
 #pragma inline_depth (25)
@@ -795,8 +796,6 @@ void SString::ConvertToUnicode(SString &s) const
     }
     CONTRACT_END;
 
-    int page = 0;
-
     switch (GetRepresentation())
     {
     case REPRESENTATION_EMPTY:
@@ -808,7 +807,6 @@ void SString::ConvertToUnicode(SString &s) const
         RETURN;
 
     case REPRESENTATION_UTF8:
-        page = CP_UTF8;
         break;
 
     case REPRESENTATION_ASCII:
@@ -819,15 +817,16 @@ void SString::ConvertToUnicode(SString &s) const
         UNREACHABLE();
     }
 
-    COUNT_T length = MultiByteToWideChar(page, 0, GetRawANSI(), GetRawCount()+1, 0, 0);
-    if (length == 0)
-        ThrowLastError();
+    // Call the converter directly rather than through MultiByteToWideChar; invalid
+    // sequences are replaced with U+FFFD, matching the previous default behavior.
+    COUNT_T length = (COUNT_T) minipal_get_length_utf8_to_utf16(GetRawUTF8(), GetRawCount(), 0);
 
-    s.Resize(length-1, REPRESENTATION_UNICODE);
+    s.Resize(length, REPRESENTATION_UNICODE);
 
-    length = MultiByteToWideChar(page, 0, GetRawANSI(), GetRawCount()+1, s.GetRawUnicode(), length);
-    if (length == 0)
-        ThrowLastError();
+    if (length > 0)
+    {
+        minipal_convert_utf8_to_utf16(GetRawUTF8(), GetRawCount(), (CHAR16_T *)s.GetRawUnicode(), length, 0);
+    }
 
     RETURN;
 }
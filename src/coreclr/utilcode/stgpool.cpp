@@ -969,6 +969,7 @@ StgStringPool::AddStringW(
     STRINGHASH  *pHash;                 // Hash item for add.
     ULONG       iLen;                   // Correct length after conversion.
     LPSTR       pData;                  // Pointer to location for new string.
+    HRESULT     hr;
 
     _ASSERTE(!m_bReadOnly);
 
@@ -1029,6 +1030,12 @@ StgStringPool::AddStringW(
         {
             *pnOffset = pHash->iOffset = GetNextOffset();
             SegAllocate(iLen);
+
+            // Check for hash chains that are too long.
+            if (m_Hash.MaxChainLength() > MAX_CHAIN_LENGTH)
+            {
+                IfFailRet(RehashStrings());
+            }
         }
         // Else use the old one.
         else
@@ -1773,6 +1773,7 @@ HRESULT SystemDomain::NotifyProfilerShutdown()
 #endif // PROFILING_SUPPORTED
 
 AppDomain::AppDomain()
+    : m_unmanagedCacheLock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT)
 {
     // initialize fields so the appdomain can be safely destructed
     // shouldn't call anything that can fail here - use ::Init instead
@@ -3217,7 +3218,7 @@ void AppDomain::AddUnmanagedImageToCache(LPCWSTR libraryName, NATIVE_LIBRARY_HAN
     }
     CONTRACTL_END;
 
-    DomainCacheCrstHolderForGCPreemp lock(this);
+    SimpleWriteLockHolder lock(&m_unmanagedCacheLock);
 
     const UnmanagedImageCacheEntry *existingEntry = m_unmanagedCache.LookupPtr(libraryName);
     if (existingEntry != NULL)
@@ -3247,7 +3248,7 @@ NATIVE_LIBRARY_HANDLE AppDomain::FindUnmanagedImageInCache(LPCWSTR libraryName)
     }
     CONTRACT_END;
 
-    DomainCacheCrstHolderForGCPreemp lock(this);
+    SimpleReadLockHolder lock(&m_unmanagedCacheLock);
 
     const UnmanagedImageCacheEntry *existingEntry = m_unmanagedCache.LookupPtr(libraryName);
     if (existingEntry == NULL)
@@ -651,7 +651,7 @@ protected:
     // Critical sections & locks
     PEFileListLock   m_FileLoadLock;            // Protects the list of assemblies in the domain
     CrstExplicitInit m_DomainCrst;              // General Protection for the Domain
-    CrstExplicitInit m_DomainCacheCrst;         // Protects the Assembly and Unmanaged caches
+    CrstExplicitInit m_DomainCacheCrst;         // Protects the Assembly cache
     // Used to protect the reference lists in the collectible loader allocators attached to this appdomain
     CrstExplicitInit m_crstLoaderAllocatorReferences;
     CrstExplicitInit m_crstGenericDictionaryExpansionLock;
@@ -699,17 +699,6 @@ public:
     };
     friend class LockHolder;
 
-    // To be used when the thread will remain in preemptive GC mode while holding the lock
-    class DomainCacheCrstHolderForGCPreemp : private CrstHolder
-    {
-    public:
-        DomainCacheCrstHolderForGCPreemp(BaseDomain *pD)
-            : CrstHolder(&pD->m_DomainCacheCrst)
-        {
-            WRAPPER_NO_CONTRACT;
-        }
-    };
-
     // To be used when the thread may enter cooperative GC mode while holding the lock. The thread enters a
     // forbid-suspend-for-debugger region along with acquiring the lock, such that it would not suspend for the debugger while
     // holding the lock, as that may otherwise cause a FuncEval to deadlock when trying to acquire the lock.
@@ -1788,6 +1777,11 @@ private:
 
     SHash<UnmanagedImageCacheTraits> m_unmanagedCache;
 
+    // Protects m_unmanagedCache. Lookups vastly outnumber additions, so a
+    // reader-writer lock lets concurrent interop library probes proceed in
+    // parallel instead of convoying on m_DomainCacheCrst.
+    SimpleRWLock m_unmanagedCacheLock;
+
 #ifdef FEATURE_TYPEEQUIVALENCE
 private:
     VolatilePtr<TypeEquivalenceHashTable> m_pTypeEquivalenceTable;
@@ -974,6 +974,10 @@ protected:
 
         METHOD_INVOKE_NEEDS_ACTIVATION  = 0x0040,   // Flag used by ArgIteratorForMethodInvoke
 
+        METHOD_INVOKE_SIMPLE_RETURN     = 0x0080,   // Flag used by ArgIteratorForMethodInvoke. The method returns
+                                                    // void or an object reference, so the invoke path needs no
+                                                    // return buffer, value type copy or byref boxing handling.
+
         RETURN_FP_SIZE_SHIFT            = 8,        // The rest of the flags is cached value of GetFPReturnSize
     };
 
@@ -184,8 +184,10 @@ private:
     static const DWORD INITIAL_CACHE_SIZE = 8;    // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 512;  // make this lower than release to make it easier to reach this in tests.
 #else
-    static const DWORD INITIAL_CACHE_SIZE = 128;  // MUST BE A POWER OF TWO
-    static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
+    static const DWORD INITIAL_CACHE_SIZE = 128;   // MUST BE A POWER OF TWO
+    static const DWORD MAXIMUM_CACHE_SIZE = 32768; // 32768 * sizeof(CastCacheEntry) is 786432 bytes on 64bit.
+                                                   // Only reached on demand, by doubling from INITIAL_CACHE_SIZE
+                                                   // when misses keep forcing growth.
 #endif
 
 // Lower bucket size will cause the table to resize earlier
@@ -1183,6 +1183,13 @@ void Module::AllocateMaps()
         GENERICTYPEDEF_MAP_INITIAL_SIZE = 5,
         FILEREFERENCES_MAP_INITIAL_SIZE = 5,
         ASSEMBLYREFERENCES_MAP_INITIAL_SIZE = 5,
+
+        // Cap on the eagerly allocated block of the metadata-sized maps below. In large
+        // processes most modules never populate the tail of these maps, so RIDs beyond
+        // the cap are covered on demand by GrowMap when one is first stored (see
+        // dwFullCountHint), keeping per-module map memory proportional to the RIDs
+        // actually in use.
+        RID_MAP_INITIAL_BLOCK_MAX = 1024,
     };
 
     PTR_TADDR pTable = NULL;
@@ -1208,23 +1215,35 @@ void Module::AllocateMaps()
     {
         IMDInternalImport * pImport = GetMDImport();
 
+        // The TypeDef, MemberRef, MethodDef and FieldDef maps are clamped to
+        // RID_MAP_INITIAL_BLOCK_MAX entries: all their writers grow the map on demand
+        // (via EnsureElementCanBeStored/AddElement), so the tail is only allocated for
+        // modules that actually store high RIDs. The remaining maps stay eagerly sized;
+        // their consumers rely on the full range being present up front (the TypeRef
+        // lookaside stores via the non-growing TrySetElement, and GetAssemblyRefMax
+        // reports the map size).
+
         // Get # TypeDefs (add 1 for COR_GLOBAL_PARENT_TOKEN)
-        m_TypeDefToMethodTableMap.dwCount = pImport->GetCountWithTokenKind(mdtTypeDef)+2;
+        m_TypeDefToMethodTableMap.dwFullCountHint = pImport->GetCountWithTokenKind(mdtTypeDef)+2;
+        m_TypeDefToMethodTableMap.dwCount = min(m_TypeDefToMethodTableMap.dwFullCountHint, (DWORD)RID_MAP_INITIAL_BLOCK_MAX);
 
         // Get # TypeRefs
         m_TypeRefToMethodTableMap.dwCount = pImport->GetCountWithTokenKind(mdtTypeRef)+1;
 
         // Get # MemberRefs
-        m_MemberRefMap.dwCount = pImport->GetCountWithTokenKind(mdtMemberRef)+1;
+        m_MemberRefMap.dwFullCountHint = pImport->GetCountWithTokenKind(mdtMemberRef)+1;
+        m_MemberRefMap.dwCount = min(m_MemberRefMap.dwFullCountHint, (DWORD)RID_MAP_INITIAL_BLOCK_MAX);
 
         // Get # MethodDefs
-        m_MethodDefToDescMap.dwCount = pImport->GetCountWithTokenKind(mdtMethodDef)+1;
+        m_MethodDefToDescMap.dwFullCountHint = pImport->GetCountWithTokenKind(mdtMethodDef)+1;
+        m_MethodDefToDescMap.dwCount = min(m_MethodDefToDescMap.dwFullCountHint, (DWORD)RID_MAP_INITIAL_BLOCK_MAX);
 
         // IL code versions are relatively rare so keep small.
         m_ILCodeVersioningStateMap.dwCount = 1;
 
         // Get # FieldDefs
-        m_FieldDefToDescMap.dwCount = pImport->GetCountWithTokenKind(mdtFieldDef)+1;
+        m_FieldDefToDescMap.dwFullCountHint = pImport->GetCountWithTokenKind(mdtFieldDef)+1;
+        m_FieldDefToDescMap.dwCount = min(m_FieldDefToDescMap.dwFullCountHint, (DWORD)RID_MAP_INITIAL_BLOCK_MAX);
 
         // Get # GenericParams
         m_GenericParamToDescMap.dwCount = pImport->GetCountWithTokenKind(mdtGenericParam)+1;
@@ -2583,6 +2602,15 @@ PTR_TADDR LookupMapBase::GrowMap(ModuleBase * pModule, DWORD rid)
 
         DWORD dwSizeToAllocate = max(dwIndex + 1, dwBlockSize);
 
+        // If the initial block was clamped below the module's metadata counts (see
+        // Module::AllocateMaps), extend straight to the full size so that lookup
+        // chains stay short and subsequent stores need no further growth.
+        DWORD dwCovered = rid - dwIndex;
+        if (dwFullCountHint > dwCovered)
+        {
+            dwSizeToAllocate = max(dwSizeToAllocate, dwFullCountHint - dwCovered);
+        }
+
         pNewMap = (LookupMapBase *) (void*)pModule->GetLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(LookupMapBase)) + S_SIZE_T(dwSizeToAllocate)*S_SIZE_T(sizeof(TADDR)));
 
         // Note: Memory allocated on loader heap is zero filled
@@ -100,6 +100,12 @@ struct LookupMapBase
     // Number of elements in this node (only RIDs less than this value can be present in this node)
     DWORD               dwCount;
 
+    // Number of RIDs the module's metadata calls for, when the initial block was
+    // deliberately allocated smaller than that (see Module::AllocateMaps). GrowMap uses
+    // this to extend a clamped map to its full size in a single step, keeping lookup
+    // chains short. Zero when the initial block was not clamped.
+    DWORD               dwFullCountHint;
+
     // Set of flags that the map supports writing on top of the data value
     TADDR               supportedFlags;
 
@@ -163,6 +163,7 @@
 #include "jithost.h"
 #include "pgo.h"
 #include "pendingload.h"
+#include "customattribute.h"
 
 #ifndef TARGET_UNIX
 #include "dwreport.h"
@@ -922,6 +923,7 @@ void EEStartupHelper()
 
 
         Assembly::Initialize();
+        Attribute::Initialize();
 
         SystemDomain::System()->Init();
 
@@ -70,6 +70,8 @@ unsigned   ExecutionManager::m_LCG_JumpStubUnique;
 unsigned   ExecutionManager::m_LCG_JumpStubBlockAllocCount;
 unsigned   ExecutionManager::m_LCG_JumpStubBlockFullCount;
 
+RangeSection* ExecutionManager::s_pRangeSectionCache[ExecutionManager::RANGE_SECTION_CACHE_SIZE];
+
 #endif // DACCESS_COMPILE
 
 #if defined(TARGET_AMD64) && !defined(DACCESS_COMPILE) // We don't do this on ARM just amd64
@@ -2488,6 +2490,7 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isHot = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2603,6 +2606,7 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
     _ASSERTE (pHp != NULL);
     _ASSERTE (pHp->maxCodeHeapSize >= initialRequestSize);
 
+    pHp->isHot = pInfo->IsHot();
     pHp->SetNext(GetCodeHeapList());
 
     EX_TRY
@@ -2668,12 +2672,21 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     HeapList * pCodeHeap    = NULL;
     DomainCodeHeapList *pList = NULL;
 
-    // Avoid going through the full list in the common case - try to use the most recently used codeheap
+    // Avoid going through the full list in the common case - try to use the most recently used codeheap.
+    // Hot (optimized) code keeps its own cache slot: tier-0 and tier-1 compiles interleave freely, and
+    // letting them share one slot would evict each other's heap on every switch. Keeping the slots apart
+    // also keeps consecutively promoted hot methods filling the same heap back to back, which is what
+    // packs the long-lived working set densely.
     if (pInfo->IsDynamicDomain())
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap;
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = NULL;
     }
+    else if (pInfo->IsHot())
+    {
+        pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedHotCodeHeap;
+        pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = NULL;
+    }
     else
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
@@ -2734,6 +2747,10 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     {
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = pCodeHeap;
     }
+    else if (pInfo->IsHot())
+    {
+        pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = pCodeHeap;
+    }
     else
     {
         pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
@@ -2753,7 +2770,7 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isHotCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                              size_t* pAllocatedSize, HeapList** ppCodeHeap
                            , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2808,6 +2825,14 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+    // Route optimized code into the hot code heaps so the long-lived working set stays
+    // densely packed. Collectible code keeps a unified heap: its heaps are already
+    // per-LoaderAllocator and splitting them would double the reserve per assembly.
+    if (isHotCode && !requestInfo.IsDynamicDomain() && !requestInfo.IsCollectible())
+    {
+        requestInfo.SetHot();
+    }
+
 #ifdef FEATURE_EH_FUNCLETS
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 #else
@@ -2936,6 +2961,15 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
         PRECONDITION(m_CodeHeapCritSec.OwnedByCurrentThread());
     } CONTRACTL_END;
 
+    // Hot (tier-1/optimized) code is kept in separate code heaps from tier-0 code and
+    // stubs, so the long-term working set packs into fewer pages. Requests with an
+    // address range constraint (jump stub blocks) are exempt; for those, being within
+    // range trumps locality.
+    if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0) && (pCodeHeap->isHot != pInfo->IsHot()))
+    {
+        return false;
+    }
+
     bool retVal = false;
 
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
@@ -4614,7 +4648,31 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr, RangeSectionLockStat
         SUPPORTS_DAC;
     } CONTRACTL_END;
 
-    return GetCodeRangeMap()->LookupRangeSection(addr, pLockState);
+#ifndef DACCESS_COMPILE
+    // Consult the lock-free cache first; steady-state stack walks (sampling
+    // profilers in particular) keep resolving IPs in the same few sections,
+    // and a hit avoids the multi-level map walk entirely.
+    DWORD slot = (DWORD)(addr >> 16) & (RANGE_SECTION_CACHE_SIZE - 1);
+    RangeSection* pCached = VolatileLoad(&s_pRangeSectionCache[slot]);
+    if ((pCached != NULL) && pCached->_range.IsInRange(addr))
+    {
+        return pCached;
+    }
+#endif
+
+    RangeSection* pRS = GetCodeRangeMap()->LookupRangeSection(addr, pLockState);
+
+#ifndef DACCESS_COMPILE
+    // Only non-collectible sections may be cached; they are never deleted, so
+    // cached pointers cannot dangle. Collectible ones require the lock
+    // protocol the map itself implements.
+    if ((pRS != NULL) && ((pRS->_flags & RangeSection::RANGE_SECTION_COLLECTIBLE) == 0))
+    {
+        VolatileStore(&s_pRangeSectionCache[slot], pRS);
+    }
+#endif
+
+    return pRS;
 }
 
 /* static */
@@ -4768,6 +4826,15 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
     } CONTRACTL_END;
 
     RangeSection *pCurr = FindCodeRangeWithLock(pStartRange);
+
+    // Only collectible sections are ever deleted, and those are never placed in the
+    // range section cache. Still, clear the cache defensively before removing the
+    // section from the map so no stale pointer can outlive the section.
+    for (DWORD i = 0; i < RANGE_SECTION_CACHE_SIZE; i++)
+    {
+        VolatileStore(&s_pRangeSectionCache[i], (RangeSection*)NULL);
+    }
+
     GetCodeRangeMap()->RemoveRangeSection(pCurr);
 
 
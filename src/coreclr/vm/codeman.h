@@ -274,6 +274,7 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isHot;            // allocation is for optimized (tier-1) code with a long-lived working set
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
@@ -281,6 +282,9 @@ struct CodeHeapRequestInfo
 
     bool   IsCollectible()                      { return m_isCollectible;      }
 
+    bool   IsHot()                              { return m_isHot;              }
+    void   SetHot()                             { m_isHot = true;              }
+
     size_t getRequestSize()                     { return m_requestSize;        }
     void   setRequestSize(size_t requestSize)   { m_requestSize = requestSize; }
 
@@ -382,6 +386,7 @@ struct HeapList
 
     size_t              maxCodeHeapSize;// Size of the entire contiguous block of memory
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
+    bool                isHot;          // Heap is reserved for optimized (tier-1) code
 
     PTR_LoaderAllocator pLoaderAllocator; // LoaderAllocator of HeapList
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
@@ -1773,7 +1778,7 @@ public:
 
     BOOL                LoadJIT();
 
-    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isHotCode, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                                   size_t* pAllocatedSize, HeapList** ppCodeHeap
                                 , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2118,6 +2123,15 @@ private:
 
     static RangeSection* GetRangeSection(TADDR addr, RangeSectionLockState *pLockState);
 
+#ifndef DACCESS_COMPILE
+    // Lock-free cache of recently returned non-collectible RangeSections, consulted
+    // before walking the RangeSectionMap. Only non-collectible sections are cached:
+    // they are never freed, so a stale entry can at worst miss, never dangle. Hot for
+    // sampling profilers, which resolve IP->method at high frequency from many threads.
+    static const DWORD RANGE_SECTION_CACHE_SIZE = 16; // must be a power of two
+    static RangeSection* s_pRangeSectionCache[RANGE_SECTION_CACHE_SIZE];
+#endif
+
     SPTR_DECL(EECodeManager, m_pDefaultCodeMan);
 
     SPTR_DECL(EEJitManager, m_pEEJitManager);
@@ -16,6 +16,124 @@
 #include "runtimehandles.h"
 #include "typestring.h"
 
+//
+// Custom attribute blobs spell out enum and System.Type arguments as serialized type
+// name strings, and reflection parses the same attribute instances over and over.
+// Resolving such a name is by far the most expensive part of decoding the argument,
+// so the results are cached here, keyed by the resolution scope and the name bytes.
+// Only resolutions where neither the requesting assembly nor the resolved type is
+// collectible are cached, so entries can never go stale.
+//
+
+struct CaResolvedTypeName
+{
+    Assembly* m_pAssembly;      // the assembly the name was resolved from
+    LPCUTF8   m_szName;         // heap copy of the serialized type name
+    COUNT_T   m_cbName;
+    TypeHandle m_th;
+};
+
+struct CaResolvedTypeNameKey
+{
+    Assembly* m_pAssembly;
+    LPCUTF8   m_szName;
+    COUNT_T   m_cbName;
+};
+
+class CaResolvedTypeNameTraits : public NoRemoveSHashTraits<DefaultSHashTraits<CaResolvedTypeName*>>
+{
+public:
+    typedef CaResolvedTypeNameKey key_t;
+
+    static key_t GetKey(element_t e)
+    {
+        LIMITED_METHOD_CONTRACT;
+        CaResolvedTypeNameKey key = { e->m_pAssembly, e->m_szName, e->m_cbName };
+        return key;
+    }
+
+    static BOOL Equals(key_t k1, key_t k2)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (k1.m_pAssembly == k2.m_pAssembly)
+            && (k1.m_cbName == k2.m_cbName)
+            && (memcmp(k1.m_szName, k2.m_szName, k1.m_cbName) == 0);
+    }
+
+    static count_t Hash(key_t k)
+    {
+        LIMITED_METHOD_CONTRACT;
+        count_t hash = (count_t)(size_t)k.m_pAssembly;
+        for (COUNT_T i = 0; i < k.m_cbName; i++)
+        {
+            hash = ((hash << 5) + hash) ^ (count_t)k.m_szName[i];
+        }
+        return hash;
+    }
+
+    static element_t Null() { LIMITED_METHOD_CONTRACT; return NULL; }
+    static bool IsNull(const element_t &e) { LIMITED_METHOD_CONTRACT; return e == NULL; }
+};
+
+static CrstStatic s_caResolvedTypeNameCrst;
+static SHash<CaResolvedTypeNameTraits>* s_pCaResolvedTypeNames;
+
+void Attribute::Initialize()
+{
+    s_caResolvedTypeNameCrst.Init(CrstLeafLock, CRST_UNSAFE_ANYMODE);
+}
+
+static TypeHandle GetCachedTypeReferencedByCustomAttribute(LPCUTF8 szName, COUNT_T cbName, Assembly* pAssembly)
+{
+    CONTRACTL
+    {
+        PRECONDITION(CheckPointer(pAssembly));
+        PRECONDITION(CheckPointer(szName));
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    CaResolvedTypeNameKey key = { pAssembly, szName, cbName };
+
+    {
+        CrstHolder ch(&s_caResolvedTypeNameCrst);
+        if (s_pCaResolvedTypeNames != NULL)
+        {
+            CaResolvedTypeName* pEntry = s_pCaResolvedTypeNames->Lookup(key);
+            if (pEntry != NULL)
+                return pEntry->m_th;
+        }
+    }
+
+    StackSString sszName(SString::Utf8, szName, cbName);
+    TypeHandle th = TypeName::GetTypeReferencedByCustomAttribute(sszName.GetUTF8(), pAssembly);
+
+    if (!th.IsNull() && !pAssembly->IsCollectible() && !th.GetLoaderAllocator()->IsCollectible())
+    {
+        NewHolder<CaResolvedTypeName> pEntry = new CaResolvedTypeName();
+        NewArrayHolder<CHAR> szNameCopy = new CHAR[cbName];
+        memcpy(szNameCopy, szName, cbName);
+        pEntry->m_pAssembly = pAssembly;
+        pEntry->m_szName = szNameCopy;
+        pEntry->m_cbName = cbName;
+        pEntry->m_th = th;
+
+        CrstHolder ch(&s_caResolvedTypeNameCrst);
+        if (s_pCaResolvedTypeNames == NULL)
+            s_pCaResolvedTypeNames = new SHash<CaResolvedTypeNameTraits>();
+        if (s_pCaResolvedTypeNames->Lookup(key) == NULL)
+        {
+            s_pCaResolvedTypeNames->Add(pEntry);
+            szNameCopy.SuppressRelease();
+            pEntry.SuppressRelease();
+        }
+    }
+
+    return th;
+}
+
 static TypeHandle GetTypeForEnum(LPCUTF8 szEnumName, COUNT_T cbEnumName, DomainAssembly* pDomainAssembly)
 {
     CONTRACTL
@@ -29,8 +147,7 @@ static TypeHandle GetTypeForEnum(LPCUTF8 szEnumName, COUNT_T cbEnumName, DomainA
     }
     CONTRACTL_END;
 
-    StackSString sszEnumName(SString::Utf8, szEnumName, cbEnumName);
-    return TypeName::GetTypeReferencedByCustomAttribute(sszEnumName.GetUnicode(), pDomainAssembly->GetAssembly());
+    return GetCachedTypeReferencedByCustomAttribute(szEnumName, cbEnumName, pDomainAssembly->GetAssembly());
 }
 
 static HRESULT ParseCaType(
@@ -448,7 +565,7 @@ static TypeHandle GetTypeHandleFromBlob(Assembly *pCtorAssembly,
         *pBlob += size;
         szName[size] = 0;
 
-        RtnTypeHnd = TypeName::GetTypeReferencedByCustomAttribute(szName, pModule->GetAssembly());
+        RtnTypeHnd = GetCachedTypeReferencedByCustomAttribute(szName, (COUNT_T)size, pModule->GetAssembly());
         break;
     }
 
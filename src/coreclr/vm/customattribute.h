@@ -12,6 +12,8 @@ using CaValueArrayFactory = Factory<SArray<CaValue>>;
 
 namespace Attribute
 {
+    void Initialize();
+
     HRESULT ParseArgumentValues(
         void* pCa,
         INT32 cCa,
@@ -307,6 +307,19 @@ private:
         return VolatileLoadWithoutBarrier(&m_pBuckets);
     }
 
+    // Map a hash value to a bucket index for a table with cBuckets buckets. The
+    // multiply-shift range reduction replaces a prime-modulus division on the hot lookup
+    // path (bucket counts are still primes, which multiply-shift handles just as well as
+    // any other count). The Fibonacci mix beforehand compensates for low-entropy hash
+    // values, which a plain multiply-shift would otherwise crowd into few buckets.
+    static DWORD BucketFromHash(DacEnumerableHashValue iHash, DWORD cBuckets)
+    {
+        SUPPORTS_DAC;
+
+        DWORD mixed = (DWORD)(iHash * 2654435769u);
+        return (DWORD)(((UINT64)mixed * cBuckets) >> 32);
+    }
+
     // our bucket table uses two extra slots - slot [0] contains the length of the table,
     //                                         slot [1] will contain the next version of the table if it resizes
     static const int SLOT_LENGTH = 0;
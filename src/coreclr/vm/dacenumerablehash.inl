@@ -146,7 +146,7 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::BaseInsertEntry(DacEnumerableHa
     DWORD cBuckets = GetLength(curBuckets);
 
     // Compute which bucket the entry belongs in based on the hash. (+2 to skip "length" and "next" slots)
-    DWORD dwBucket = iHash % cBuckets + SKIP_SPECIAL_SLOTS;
+    DWORD dwBucket = BucketFromHash(iHash, cBuckets) + SKIP_SPECIAL_SLOTS;
 
     // Prepare to link the new entry at the head of the bucket chain.
     pVolatileEntry->m_pNextEntry = curBuckets[dwBucket];
@@ -243,7 +243,7 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::GrowTable()
 
         while (!IsEndSentinel(pEntry))
         {
-            DWORD dwNewBucket = (pEntry->m_iHashValue % cNewBuckets) + SKIP_SPECIAL_SLOTS;
+            DWORD dwNewBucket = BucketFromHash(pEntry->m_iHashValue, cNewBuckets) + SKIP_SPECIAL_SLOTS;
             PTR_VolatileEntry pNextEntry  = pEntry->m_pNextEntry;
 
             PTR_VolatileEntry pTail = pNewBuckets[dwNewBucket];
@@ -348,7 +348,7 @@ DPTR(VALUE) DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::BaseFindFirstEntryByHash
 
         // Compute which bucket the entry belongs in based on the hash.
         // +2 to skip "length" and "next" slots
-        DWORD dwBucket = iHash % cBuckets + SKIP_SPECIAL_SLOTS;
+        DWORD dwBucket = BucketFromHash(iHash, cBuckets) + SKIP_SPECIAL_SLOTS;
 
         // Point at the first entry in the bucket chain that stores entries with the given hash code.
         PTR_VolatileEntry pEntry = VolatileLoadWithoutBarrier(&curBuckets[dwBucket]);
@@ -577,6 +577,74 @@ void CompressDebugInfo::CompressRichDebugInfo(
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Many methods compress to byte-identical debug info blobs - generated and
+// property-style methods in particular repeat the same few boundary patterns.
+// Blobs for methods in non-collectible loader allocators live for the process
+// lifetime, so identical ones are shared between methods instead of being
+// stored once per method. Collectible loader allocators are excluded: their
+// blobs die with the allocator, so a shared copy could be torn away from
+// methods that still reference it.
+//-----------------------------------------------------------------------------
+
+struct SharedDebugInfoBlob
+{
+    BYTE * m_pData;
+    DWORD  m_cb;
+};
+
+static PtrHashMap *   s_pSharedDebugInfoTable = NULL;
+static SimpleRWLock * s_pSharedDebugInfoLock  = NULL;
+
+static BOOL SharedDebugInfoLockOwner(LPVOID lock)
+{
+    // SimpleRWLock does not track which thread holds it, so there is nothing
+    // stronger to assert here.
+    return TRUE;
+}
+
+static BOOL CompareSharedDebugInfoBlobs(UPTR u1, UPTR u2)
+{
+    WRAPPER_NO_CONTRACT;
+
+    SharedDebugInfoBlob * pProbe = (SharedDebugInfoBlob *)(u1 << 1);
+    SharedDebugInfoBlob * pEntry = (SharedDebugInfoBlob *)u2;
+
+    return (pProbe->m_cb == pEntry->m_cb) &&
+        (memcmp(pProbe->m_pData, pEntry->m_pData, pProbe->m_cb) == 0);
+}
+
+static void EnsureSharedDebugInfoTable()
+{
+    CONTRACTL {
+        THROWS;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    LoaderHeap * pGlobalHeap = SystemDomain::GetGlobalLoaderAllocator()->GetLowFrequencyHeap();
+
+    if (s_pSharedDebugInfoLock == NULL)
+    {
+        void * pLockSpace = pGlobalHeap->AllocMem(S_SIZE_T(sizeof(SimpleRWLock)));
+        SimpleRWLock * pLock = new (pLockSpace) SimpleRWLock(COOPERATIVE_OR_PREEMPTIVE, LOCK_TYPE_DEFAULT);
+
+        if (InterlockedCompareExchangeT(&s_pSharedDebugInfoLock, pLock, NULL) != NULL)
+            pGlobalHeap->BackoutMem(pLockSpace, sizeof(SimpleRWLock));
+    }
+
+    if (s_pSharedDebugInfoTable == NULL)
+    {
+        SimpleWriteLockHolder swlh(s_pSharedDebugInfoLock);
+        if (s_pSharedDebugInfoTable == NULL)
+        {
+            PtrHashMap * pMap = new (pGlobalHeap) PtrHashMap();
+            LockOwner lock = {s_pSharedDebugInfoLock, SharedDebugInfoLockOwner};
+            pMap->Init(32, CompareSharedDebugInfoBlobs, FALSE, &lock);
+            s_pSharedDebugInfoTable = pMap;
+        }
+    }
+}
+
 PTR_BYTE CompressDebugInfo::CompressBoundariesAndVars(
     IN ICorDebugInfo::OffsetMapping*     pOffsetMapping,
     IN ULONG                             iOffsetMapping,
@@ -588,7 +656,7 @@ PTR_BYTE CompressDebugInfo::CompressBoundariesAndVars(
     IN ICorDebugInfo::RichOffsetMapping* pRichOffsetMappings,
     IN ULONG                             iRichOffsetMappings,
     IN BOOL                              writeFlagByte,
-    IN LoaderHeap*                       pLoaderHeap
+    IN LoaderAllocator*                  pLoaderAllocator
     )
 {
     CONTRACTL {
@@ -598,9 +666,11 @@ PTR_BYTE CompressDebugInfo::CompressBoundariesAndVars(
         PRECONDITION((iInlineTree == 0) || (pInlineTree != NULL));
         PRECONDITION((iRichOffsetMappings == 0) || (pRichOffsetMappings != NULL));
         PRECONDITION(writeFlagByte || ((patchpointInfo == NULL) && (iInlineTree == 0) && (iRichOffsetMappings == 0)));
-        PRECONDITION(pLoaderHeap != NULL);
+        PRECONDITION(pLoaderAllocator != NULL);
     } CONTRACTL_END;
 
+    LoaderHeap* pLoaderHeap = pLoaderAllocator->GetLowFrequencyHeap();
+
     // Patchpoint info is currently uncompressed.
     DWORD cbPatchpointInfo = 0;
 
@@ -661,7 +731,16 @@ PTR_BYTE CompressDebugInfo::CompressBoundariesAndVars(
     if (cbFinalSize.IsOverflow())
         ThrowHR(COR_E_OVERFLOW);
 
-    BYTE *ptrStart = (BYTE *)(void *)pLoaderHeap->AllocMem(S_SIZE_T(cbFinalSize.Value()));
+    // Assemble shareable blobs in a scratch buffer first so the result can be
+    // matched against previously stored ones before committing heap memory.
+    BOOL fShareBlob = !pLoaderAllocator->IsCollectible();
+    CQuickBytes qbBlob;
+
+    BYTE *ptrStart;
+    if (fShareBlob)
+        ptrStart = (BYTE *)qbBlob.AllocThrows(cbFinalSize.Value());
+    else
+        ptrStart = (BYTE *)(void *)pLoaderHeap->AllocMem(S_SIZE_T(cbFinalSize.Value()));
     BYTE *ptr = ptrStart;
 
     if (writeFlagByte)
@@ -698,7 +777,40 @@ PTR_BYTE CompressDebugInfo::CompressBoundariesAndVars(
         memcpy(ptr, pVars, cbVars);
     ptr += cbVars;
 
-    return ptrStart;
+    if (!fShareBlob)
+        return ptrStart;
+
+    EnsureSharedDebugInfoTable();
+
+    DWORD cbBlob = cbFinalSize.Value();
+    ULONG hashBlob = HashBytes(ptrStart, cbBlob);
+    SharedDebugInfoBlob probe = { ptrStart, cbBlob };
+
+    {
+        SimpleReadLockHolder srlh(s_pSharedDebugInfoLock);
+        SharedDebugInfoBlob * pExisting =
+            (SharedDebugInfoBlob *)s_pSharedDebugInfoTable->LookupValue(hashBlob, &probe);
+        if (pExisting != (SharedDebugInfoBlob *)INVALIDENTRY)
+            return pExisting->m_pData;
+    }
+
+    SimpleWriteLockHolder swlh(s_pSharedDebugInfoLock);
+
+    SharedDebugInfoBlob * pExisting =
+        (SharedDebugInfoBlob *)s_pSharedDebugInfoTable->LookupValue(hashBlob, &probe);
+    if (pExisting != (SharedDebugInfoBlob *)INVALIDENTRY)
+        return pExisting->m_pData;
+
+    BYTE * pPersisted = (BYTE *)(void *)pLoaderHeap->AllocMem(S_SIZE_T(cbBlob));
+    memcpy(pPersisted, ptrStart, cbBlob);
+
+    SharedDebugInfoBlob * pEntry = (SharedDebugInfoBlob *)(void *)
+        SystemDomain::GetGlobalLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(SharedDebugInfoBlob)));
+    pEntry->m_pData = pPersisted;
+    pEntry->m_cb = cbBlob;
+    s_pSharedDebugInfoTable->InsertValue(hashBlob, pEntry);
+
+    return pPersisted;
 }
 
 #endif // DACCESS_COMPILE
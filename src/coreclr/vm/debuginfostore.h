@@ -13,6 +13,8 @@
 
 #include "nibblestream.h"
 
+class LoaderAllocator;
+
 //-----------------------------------------------------------------------------
 // Information to request Debug info.
 //-----------------------------------------------------------------------------
@@ -83,7 +85,9 @@ class CompressDebugInfo
         IN OUT NibbleWriter*                 pWriter);
 
 public:
-    // Stores the result in LoaderHeap
+    // Stores the result in the loader allocator's low-frequency heap.
+    // Identical blobs produced for methods in non-collectible loader
+    // allocators are shared rather than stored once per method.
     static PTR_BYTE CompressBoundariesAndVars(
         IN ICorDebugInfo::OffsetMapping * pOffsetMapping,
         IN ULONG            iOffsetMapping,
@@ -95,7 +99,7 @@ public:
         IN ICorDebugInfo::RichOffsetMapping * pRichOffsetMappings,
         IN ULONG            iRichOffsetMappings,
         IN BOOL             writeFlagByte,
-        IN LoaderHeap     * pLoaderHeap
+        IN LoaderAllocator * pLoaderAllocator
     );
 
     // Uncompress data supplied by Compress functions.
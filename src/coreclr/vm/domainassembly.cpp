@@ -591,6 +591,7 @@ void DomainAssembly::Activate()
     if (m_pModule->IsReadyToRun())
     {
         m_pModule->GetReadyToRunInfo()->RegisterUnrelatedR2RModule();
+        m_pModule->GetReadyToRunInfo()->MaybeStartBackgroundMethodFixupWorker();
     }
 #endif
 
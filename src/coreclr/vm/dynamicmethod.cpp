@@ -1043,11 +1043,25 @@ void LCGMethodResolver::Destroy()
         m_pJumpStubCache = NULL;
     }
 
-    // Note that we need to do this before m_jitTempData is deleted
+    // Note that we need to do this before m_jitTempData is reset
     RecycleIndCells();
 
-    m_jitMetaHeap.Delete();
-    m_jitTempData.Delete();
+    if (!GetDynamicMethod()->GetLoaderAllocator()->IsCollectible())
+    {
+        // Keep one chunk in each allocator; this method desc goes back on the
+        // free list and the next dynamic method using it allocates from the
+        // retained chunk without going back to the process allocator.
+        // Resolvers in collectible loader allocators must not retain anything:
+        // they are never destructed individually, so a retained chunk would
+        // leak when the loader allocator is collected.
+        m_jitMetaHeap.Reset();
+        m_jitTempData.Reset();
+    }
+    else
+    {
+        m_jitMetaHeap.Delete();
+        m_jitTempData.Delete();
+    }
 
     if (m_managedResolver)
     {
@@ -1516,6 +1530,35 @@ void ChunkAllocator::Delete()
     }
 }
 
+void ChunkAllocator::Reset()
+{
+    LIMITED_METHOD_CONTRACT;
+    BYTE *pKeep = NULL;
+    LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - resetting...\n", this));
+    while (m_pData)
+    {
+        BYTE *next = ((BYTE**)m_pData)[0];
+        if (pKeep == NULL && ((size_t*)m_pData)[2] == CHUNK_SIZE)
+        {
+            // retain one standard-size block with all of its space available again
+            pKeep = m_pData;
+            ((size_t*)pKeep)[1] = CHUNK_SIZE - (sizeof(void*) * 3);
+        }
+        else
+        {
+            LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - delete block {0x%p}\n", this, m_pData));
+            delete[] m_pData;
+        }
+        m_pData = next;
+    }
+
+    if (pKeep)
+    {
+        ((BYTE**)pKeep)[0] = NULL;
+    }
+    m_pData = pKeep;
+}
+
 void* ChunkAllocator::New(size_t size)
 {
     CONTRACTL
@@ -1538,28 +1581,30 @@ void* ChunkAllocator::New(size_t size)
         {
             LOG((LF_BCL, LL_INFO100, "Level2 - DM - Allocator [0x%p] - reusing block {0x%p}\n", this, m_pData));
             ((size_t*)m_pData)[1] = available - size;
-            pNewBlock = (m_pData + CHUNK_SIZE - available);
+            pNewBlock = (m_pData + ((size_t*)m_pData)[2] - available);
             LOG((LF_BCL, LL_INFO100, "Level2 - DM - Allocator [0x%p] - ptr -> 0x%p, available 0x%X\n", this, pNewBlock, ((size_t*)m_pData)[1]));
             return pNewBlock;
         }
     }
 
     // no available - need to allocate a new buffer
-    if (size + (sizeof(void*) * 2) < CHUNK_SIZE)
+    if (size + (sizeof(void*) * 3) < CHUNK_SIZE)
     {
         // make the allocation
         NewArrayHolder<BYTE> newBlock(new BYTE[CHUNK_SIZE]);
         pNewBlock = (BYTE*)newBlock;
-        ((size_t*)pNewBlock)[1] = CHUNK_SIZE - size - (sizeof(void*) * 2);
+        ((size_t*)pNewBlock)[1] = CHUNK_SIZE - size - (sizeof(void*) * 3);
+        ((size_t*)pNewBlock)[2] = CHUNK_SIZE;
         LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - new block {0x%p}\n", this, pNewBlock));
         newBlock.SuppressRelease();
     }
     else
     {
         // request bigger than default size this is going to be a single block
-        NewArrayHolder<BYTE> newBlock(new BYTE[size + (sizeof(void*) * 2)]);
+        NewArrayHolder<BYTE> newBlock(new BYTE[size + (sizeof(void*) * 3)]);
         pNewBlock = (BYTE*)newBlock;
         ((size_t*)pNewBlock)[1] = 0; // no available bytes left
+        ((size_t*)pNewBlock)[2] = size + (sizeof(void*) * 3);
         LOG((LF_BCL, LL_INFO10, "Level1 - DM - Allocator [0x%p] - new BIG block {0x%p}\n", this, pNewBlock));
         newBlock.SuppressRelease();
     }
@@ -1586,7 +1631,7 @@ void* ChunkAllocator::New(size_t size)
         ((BYTE**)m_pData)[0] = NULL;
     }
 
-    pNewBlock += (sizeof(void*) * 2);
+    pNewBlock += (sizeof(void*) * 3);
     LOG((LF_BCL, LL_INFO100, "Level2 - DM - Allocator [0x%p] - ptr -> 0x%p, available 0x%X\n", this, pNewBlock, ((size_t*)m_pData)[1]));
     return pNewBlock;
 }
@@ -18,14 +18,14 @@
 // The idea is to have a predefined size allocated up front and used by different calls to new.
 // All the allocation will be released at the same time releaseing an instance of this class
 // Here is how the object is laid out
-// | ptr_to_next_chunk | size_left_in_chunk | data | ... | data
+// | ptr_to_next_chunk | size_left_in_chunk | size_of_chunk | data | ... | data
 // This is not a particularly efficient allocator but it works well for a small number of allocation
 // needed while jitting a method
 //
 class ChunkAllocator
 {
 private:
-    #define CHUNK_SIZE 64
+    #define CHUNK_SIZE 512
 
     BYTE *m_pData;
 
@@ -35,6 +35,12 @@ public:
     ~ChunkAllocator();
     void* New(size_t size);
     void Delete();
+
+    // Free all chunks except one standard-size chunk, which is made fully
+    // available again. Used when the owning resolver is recycled, so the next
+    // dynamic method bump-allocates from the retained chunk without hitting
+    // the process allocator.
+    void Reset();
 };
 
 struct ResolvedToken final
@@ -624,6 +624,8 @@ void BulkTypeValue::Clear()
 #endif // FEATURE_NATIVEAOT
 }
 
+BYTE * volatile BulkTypeEventLogger::s_pEventBufferCache = NULL;
+
 //---------------------------------------------------------------------------------------
 //
 // Fire an ETW event for all the types we batched so far, and then reset our state
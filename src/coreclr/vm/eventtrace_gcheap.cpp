@@ -573,6 +573,7 @@ public:
         iCurBulkRootConditionalWeakTableElementEdge(0),
         iCurBulkNodeEvent(0),
         iCurBulkEdgeEvent(0),
+        lastLoggedTypeID(0),
         bulkTypeEventLogger()
     {
         LIMITED_METHOD_CONTRACT;
@@ -666,6 +667,11 @@ public:
     // Sequence number for each GCBulkNode event
     UINT iCurBulkNodeEvent;
 
+    // The last typeID passed to LogTypeAndParametersIfNecessary. Heap walks visit long
+    // runs of same-typed objects (arrays, pools), so remembering one typeID lets us skip
+    // the locked logged-type hash probe for the common consecutive-duplicate case.
+    ULONGLONG lastLoggedTypeID;
+
     // Number of nodes currently filled out in rgGcBulkNodeValues array
     UINT cGcBulkNodeValues;
 
@@ -904,7 +910,7 @@ VOID ETW::GCLog::ObjectReference(
 
     // We send type information as necessary--only for nodes, and only for nodes that we
     // haven't already sent type info for
-    if (typeID != 0)
+    if ((typeID != 0) && (typeID != pContext->lastLoggedTypeID))
     {
         ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
             &pContext->bulkTypeEventLogger,     // Batch up this type with others to minimize events
@@ -914,6 +920,7 @@ VOID ETW::GCLog::ObjectReference(
             // hash to see if the type has already been logged
             ETW::TypeSystemLog::kTypeLogBehaviorTakeLockAndLogIfFirstTime
             );
+        pContext->lastLoggedTypeID = typeID;
     }
 
     //---------------------------------------------------------------------------------------
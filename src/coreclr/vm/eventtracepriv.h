@@ -293,6 +293,12 @@ private:
 
     BYTE *m_pBulkTypeEventBuffer;
 
+    // One-slot cache of the most recently retired event buffer. Loggers are
+    // created on the stack for every first-time-logged type on the allocation
+    // sampling path, so reusing the buffer avoids a 64K heap allocation and
+    // free per distinct type when type tracing is enabled.
+    static BYTE * volatile s_pEventBufferCache;
+
 #ifdef FEATURE_NATIVEAOT
     int LogSingleType(EEType * pEEType);
 #else
@@ -313,7 +319,11 @@ public:
         }
         CONTRACTL_END;
 
-        m_pBulkTypeEventBuffer = new (nothrow) BYTE[kSizeOfEventBuffer];
+        m_pBulkTypeEventBuffer = InterlockedExchangeT(&s_pEventBufferCache, (BYTE *)NULL);
+        if (m_pBulkTypeEventBuffer == NULL)
+        {
+            m_pBulkTypeEventBuffer = new (nothrow) BYTE[kSizeOfEventBuffer];
+        }
     }
 
     ~BulkTypeEventLogger()
@@ -326,6 +336,8 @@ public:
         }
         CONTRACTL_END;
 
+        // Park the buffer for the next logger; free it if the slot is taken.
+        m_pBulkTypeEventBuffer = InterlockedExchangeT(&s_pEventBufferCache, m_pBulkTypeEventBuffer);
         delete[] m_pBulkTypeEventBuffer;
         m_pBulkTypeEventBuffer = NULL;
     }
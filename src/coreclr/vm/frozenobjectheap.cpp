@@ -12,8 +12,20 @@
 FrozenObjectHeapManager::FrozenObjectHeapManager():
     m_Crst(CrstFrozenObjectHeap, CRST_UNSAFE_ANYMODE),
     m_SegmentRegistrationCrst(CrstFrozenObjectHeap),
-    m_CurrentSegment(nullptr)
+    m_CurrentSegment(nullptr),
+    m_InitialSegmentSize(FOH_SEGMENT_DEFAULT_SIZE)
 {
+    // Hosts with large amounts of frozen data (e.g. string literals) can pre-size the
+    // first segment so startup doesn't crawl through a series of doubling segments.
+    size_t configuredSize = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCFrozenSegmentInitialSize);
+    if (configuredSize != 0)
+    {
+        configuredSize = ALIGN_UP(configuredSize, FOH_COMMIT_SIZE);
+        if (configuredSize > FOH_COMMIT_SIZE)
+        {
+            m_InitialSegmentSize = configuredSize;
+        }
+    }
 }
 
 // Allocates an object of the give size (including header) on a frozen segment.
@@ -74,7 +86,7 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
             // obj is nullptr if the current segment is full or hasn't been allocated yet
             if (obj == nullptr)
             {
-                size_t newSegmentSize = FOH_SEGMENT_DEFAULT_SIZE;
+                size_t newSegmentSize = m_InitialSegmentSize;
                 if (m_CurrentSegment != nullptr)
                 {
                     // Double the reserved size to reduce the number of frozen segments in apps with lots of frozen objects
@@ -36,6 +36,9 @@ private:
     SArray<FrozenObjectSegment*> m_FrozenSegments;
     FrozenObjectSegment* m_CurrentSegment;
 
+    // Reserve size for the first segment; configurable via GCFrozenSegmentInitialSize
+    size_t m_InitialSegmentSize;
+
     friend class ProfilerObjectEnum;
     friend class ProfToEEInterfaceImpl;
 };
@@ -117,6 +117,144 @@ VOID GCToEEInterface::AfterGcScanRoots (int condemned, int max_gen,
  * Scan all stack roots
  */
 
+// Memoized result of the GC stack scan of a single thread.
+//
+// A thread that has not executed since its previous scan must report exactly
+// the same set of root locations again, so the (slot, flags) pairs recorded
+// during one scan can be replayed at the following scans without re-walking the
+// stack. The recording is reusable only when the CPU time consumed by the
+// thread is unchanged since it was taken - a thread cannot modify its stack
+// without executing, so an unchanged CPU time proves the stack is identical.
+// Any execution, even one that leaves the stack in a state that looks the same
+// (the typical wait loop of a parked thread pool thread), changes the CPU time
+// and forces a fresh walk.
+//
+// Memoization is restricted to threads in preemptive mode, whose scan starts at
+// an explicit transition frame; for threads interrupted in cooperative mode the
+// walk can report register roots through a context living on the scanning
+// thread's stack, which is not stable across scans. For the same reason the
+// recording is abandoned when any reported slot lies outside the scanned
+// thread's own stack range, e.g. the local variable GcReportLoaderAllocator
+// reports through for collectible assemblies.
+class StackScanRootCache
+{
+    struct RootEntry
+    {
+        Object** ppObject;
+        uint32_t flags;
+    };
+
+    // CPU time consumed by the thread when the roots were recorded. Any
+    // execution of the thread since then invalidates the recording.
+    uint64_t m_cpuTime = 0;
+    // Top explicit frame at recording time, checked as an extra guard.
+    Frame* m_pTopFrame = NULL;
+    // Stack range of the owning thread; slots outside of it abort the recording.
+    void* m_stackLimit = NULL;
+    void* m_stackBase = NULL;
+    RootEntry* m_pEntries = NULL;
+    uint32_t m_count = 0;
+    uint32_t m_capacity = 0;
+    bool m_valid = false;
+    bool m_recording = false;
+    // The real promotion callback while a recording walk is in progress.
+    promote_func* m_pPromote = NULL;
+
+public:
+    ~StackScanRootCache()
+    {
+        delete [] m_pEntries;
+    }
+
+    bool CanReplay(Thread* pThread, uint64_t cpuTime)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_valid && (cpuTime == m_cpuTime) && (pThread->GetFrame() == m_pTopFrame);
+    }
+
+    void Replay(promote_func* fn, ScanContext* sc)
+    {
+        LIMITED_METHOD_CONTRACT;
+        for (uint32_t i = 0; i < m_count; i++)
+        {
+            fn(m_pEntries[i].ppObject, sc, m_pEntries[i].flags);
+        }
+    }
+
+    void BeginRecording(Thread* pThread, uint64_t cpuTime, promote_func* fn)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_valid = false;
+        m_recording = true;
+        m_count = 0;
+        m_cpuTime = cpuTime;
+        m_pTopFrame = pThread->GetFrame();
+        m_stackLimit = pThread->GetCachedStackLimit();
+        m_stackBase = pThread->GetCachedStackBase();
+        m_pPromote = fn;
+    }
+
+    void EndRecording(bool walkCompleted)
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_valid = m_recording && walkCompleted;
+        m_recording = false;
+        m_pPromote = NULL;
+    }
+
+    void RecordRoot(Object** ppObject, uint32_t flags)
+    {
+        if (!m_recording)
+        {
+            return;
+        }
+
+        // Only slots on the scanned thread's own stack are guaranteed to be
+        // stable across scans.
+        if (((void*)ppObject < m_stackLimit) || ((void*)ppObject >= m_stackBase))
+        {
+            m_recording = false;
+            return;
+        }
+
+        if (m_count == m_capacity)
+        {
+            uint32_t newCapacity = (m_capacity == 0) ? 64 : (m_capacity * 2);
+            RootEntry* pNewEntries = new (nothrow) RootEntry[newCapacity];
+            if (pNewEntries == NULL)
+            {
+                // Memoization is best effort; the walk in progress still
+                // reports all roots directly.
+                m_recording = false;
+                return;
+            }
+            memcpy(pNewEntries, m_pEntries, m_count * sizeof(RootEntry));
+            delete [] m_pEntries;
+            m_pEntries = pNewEntries;
+            m_capacity = newCapacity;
+        }
+
+        m_pEntries[m_count].ppObject = ppObject;
+        m_pEntries[m_count].flags = flags;
+        m_count++;
+    }
+
+    // promote_func wrapper that records the reported slot before forwarding it
+    // to the real promotion callback.
+    static void RecordAndPromoteRoot(PTR_PTR_Object ppObject, ScanContext* sc, uint32_t flags)
+    {
+        StackScanRootCache* pCache = sc->thread_under_crawl->GetStackScanRootCache();
+        pCache->RecordRoot(ppObject, flags);
+        (pCache->m_pPromote)(ppObject, sc, flags);
+    }
+};
+
+void DeleteStackScanRootCache(StackScanRootCache* pCache)
+{
+    LIMITED_METHOD_CONTRACT;
+    delete pCache;
+}
+
 static void ScanStackRoots(Thread * pThread, promote_func* fn, ScanContext* sc)
 {
     GCCONTEXT   gcctx;
@@ -201,7 +339,43 @@ static void ScanStackRoots(Thread * pThread, promote_func* fn, ScanContext* sc)
 #if defined(FEATURE_EH_FUNCLETS)
         flagsStackWalk |= GC_FUNCLET_REFERENCE_REPORTING;
 #endif // defined(FEATURE_EH_FUNCLETS)
-        pThread->StackWalkFrames( GcStackCrawlCallBack, &gcctx, flagsStackWalk);
+
+        StackScanRootCache* pCache = NULL;
+        uint64_t cpuTime = 0;
+
+        // Threads parked in preemptive mode that have not executed since the
+        // previous scan report exactly the same roots, so the previous scan can
+        // be replayed instead of re-walking the stack. See StackScanRootCache.
+        if (g_pConfig->GetGCStackScanMemoization() &&
+            !pThread->PreemptiveGCDisabledOther() &&
+            pThread->GetThreadCpuTime(&cpuTime))
+        {
+            pCache = pThread->GetStackScanRootCache();
+            if (pCache == NULL)
+            {
+                pCache = new (nothrow) StackScanRootCache();
+                if (pCache != NULL)
+                {
+                    pThread->SetStackScanRootCache(pCache);
+                }
+            }
+        }
+
+        if ((pCache != NULL) && pCache->CanReplay(pThread, cpuTime))
+        {
+            pCache->Replay(fn, sc);
+        }
+        else if (pCache != NULL)
+        {
+            pCache->BeginRecording(pThread, cpuTime, fn);
+            gcctx.f = StackScanRootCache::RecordAndPromoteRoot;
+            StackWalkAction swa = pThread->StackWalkFrames( GcStackCrawlCallBack, &gcctx, flagsStackWalk);
+            pCache->EndRecording(swa != SWA_FAILED);
+        }
+        else
+        {
+            pThread->StackWalkFrames( GcStackCrawlCallBack, &gcctx, flagsStackWalk);
+        }
     }
 
     GCFrame* pGCFrame = pThread->GetGCFrame();
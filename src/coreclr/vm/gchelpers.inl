@@ -67,16 +67,32 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
     BYTE* card = (BYTE*)VolatileLoadWithoutBarrier(&g_card_table) + startingClump;
 
     // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
+    // writing. Large copies span many cards, so once the pointer is aligned mark word-sized runs of cards
+    // at a time; setting extra bytes within a word to 0xff is always safe since it can only make the GC
+    // scan more, the same as the per-byte stores.
     do
     {
-        if (*card != 0xff)
+        if ((clumpCount >= sizeof(size_t)) && (((size_t)card & (sizeof(size_t) - 1)) == 0))
         {
-            *card = 0xff;
+            size_t* cardWord = (size_t*)card;
+            if (*cardWord != ~(size_t)0)
+            {
+                *cardWord = ~(size_t)0;
+            }
+
+            card += sizeof(size_t);
+            clumpCount -= sizeof(size_t);
         }
+        else
+        {
+            if (*card != 0xff)
+            {
+                *card = 0xff;
+            }
 
-        card++;
-        clumpCount--;
+            card++;
+            clumpCount--;
+        }
     }
     while (clumpCount != 0);
 
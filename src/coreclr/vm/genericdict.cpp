@@ -1332,4 +1332,70 @@ Dictionary::PopulateEntry(
     return result;
 } // Dictionary::PopulateEntry
 
+//---------------------------------------------------------------------------------------
+//
+// Walk the dictionary layout of an exact instantiation and populate every slot whose
+// signature has already been recorded, so that code warmed through
+// RuntimeHelpers.PrepareMethod resolves its generic handle lookups eagerly instead of
+// taking JIT_GenericHandle misses on the first request. Slots added to the layout
+// after this call are still populated lazily as usual.
+//
+//static
+void
+Dictionary::PrepopulateDictionary(
+    MethodDesc *  pMD,
+    MethodTable * pMT)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        PRECONDITION((pMD != NULL) != (pMT != NULL));
+    } CONTRACTL_END;
+
+    DictionaryLayout* pDictLayout;
+    DWORD numGenericArgs;
+    if (pMT != NULL)
+    {
+        pDictLayout = pMT->GetClass()->GetDictionaryLayout();
+        numGenericArgs = pMT->GetNumGenericArgs();
+    }
+    else
+    {
+        pDictLayout = pMD->GetDictionaryLayout();
+        numGenericArgs = pMD->GetNumGenericMethodArgs();
+    }
+
+    if (pDictLayout == NULL)
+        return;
+
+    DWORD numSlots = pDictLayout->GetMaxSlots();
+    for (DWORD iSlot = 0; iSlot < numSlots; iSlot++)
+    {
+        DictionaryEntryLayout* pEntryLayout = pDictLayout->GetEntryLayout(iSlot);
+
+        // Layout slots are assigned in order, so the first empty one ends the scan.
+        if (pEntryLayout->m_signature == NULL)
+            break;
+
+        // ReadyToRun signatures need the owning module and the dictionary index and
+        // slot supplied out of band by the fixup, so they cannot be replayed from the
+        // layout alone. They are populated through the R2R lookup path instead.
+        if (pEntryLayout->m_signatureSource == FromReadyToRunImage)
+            continue;
+
+        // Skip slots that are already populated. Slots beyond the current dictionary
+        // size are unpopulated by definition; PopulateEntry expands as needed.
+        DWORD slotIndex = numGenericArgs + 1 + iSlot;
+        Dictionary* pDictionary = (pMT != NULL) ? pMT->GetDictionary() : pMD->GetMethodDictionary();
+        if ((slotIndex * sizeof(DictionaryEntry)) < pDictionary->GetDictionarySlotsSize(numGenericArgs) &&
+            !pDictionary->IsSlotEmpty(0, slotIndex))
+        {
+            continue;
+        }
+
+        DictionaryEntry* pSlot;
+        PopulateEntry(pMD, pMT, pEntryLayout->m_signature, FALSE /* nonExpansive */, &pSlot);
+    }
+} // Dictionary::PrepopulateDictionary
+
 #endif //!DACCESS_COMPILE
@@ -285,6 +285,12 @@ public:
                                          DWORD dictionaryIndexAndSlot = -1,
                                          Module * pModule = NULL);
 
+    // Eagerly resolve every slot already recorded in the dictionary layout for an
+    // exact instantiation (type or method, depending on which argument is non-NULL),
+    // so that warmed code does not take generic handle lookup misses on first use.
+    static void PrepopulateDictionary(MethodDesc * pMD,
+                                      MethodTable * pMT);
+
 private:
     static Dictionary* GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG slotIndex);
     static Dictionary* GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG slotIndex);
@@ -570,11 +570,14 @@ void *JIT_TrialAlloc::GenAllocArray(Flags flags)
     if ((flags & ALIGN8) && g_pConfig->GetDoubleArrayToLargeObjectHeapThreshold() < maxElems)
         maxElems = g_pConfig->GetDoubleArrayToLargeObjectHeapThreshold();
 #endif // FEATURE_DOUBLE_ALIGNMENT_HINT
+    // The stub bakes the LOH routing cutoff in as an immediate, so pick up a lowered
+    // GCLOHThreshold here; the threshold is fixed for the lifetime of the process.
+    unsigned lohSizeThreshold = (unsigned)min((size_t)LARGE_OBJECT_SIZE, GCHeapUtilities::GetGCHeap()->GetLOHThreshold());
     if (flags & OBJ_ARRAY)
     {
         //Since we know that the array elements are sizeof(OBJECTREF), set maxElems exactly here (use the
         //same slack from above.
-        maxElems = min(maxElems, (LARGE_OBJECT_SIZE/sizeof(OBJECTREF)) - 256);
+        maxElems = min(maxElems, (lohSizeThreshold/sizeof(OBJECTREF)) - 256);
     }
     sl.Emit32(maxElems);
 
@@ -612,10 +615,10 @@ void *JIT_TrialAlloc::GenAllocArray(Flags flags)
         // less than LARGE_OBJECT_SIZE.  This is the last bit of arithmetic before we compare against the
         // allocation context, so do it here.
 
-        // cmp eax, LARGE_OBJECT_SIZE
+        // cmp eax, lohSizeThreshold
         // ja noLock
         sl.Emit8(0x3d);
-        sl.Emit32(LARGE_OBJECT_SIZE);
+        sl.Emit32(lohSizeThreshold);
         sl.X86EmitCondJump(noLock, X86CondCode::kJA);
     }
 
@@ -708,15 +711,18 @@ void *JIT_TrialAlloc::GenAllocString(Flags flags)
     sl.Emit32((int)(size_t)&g_pStringClass);
 
     // Instead of doing elaborate overflow checks, we just limit the number of elements
-    // to (LARGE_OBJECT_SIZE - 256)/sizeof(WCHAR) or less.
+    // to (lohSizeThreshold - 256)/sizeof(WCHAR) or less.
     // This will avoid all overflow problems, as well as making sure
-    // big string objects are correctly allocated in the big object heap.
+    // big string objects are correctly allocated in the big object heap. The stub bakes
+    // the cutoff in as an immediate, so pick up a lowered GCLOHThreshold here.
 
     _ASSERTE(sizeof(WCHAR) == 2);
 
-    // cmp edx,(LARGE_OBJECT_SIZE - 256)/sizeof(WCHAR)
+    unsigned lohSizeThreshold = (unsigned)min((size_t)LARGE_OBJECT_SIZE, GCHeapUtilities::GetGCHeap()->GetLOHThreshold());
+
+    // cmp edx,(lohSizeThreshold - 256)/sizeof(WCHAR)
     sl.Emit16(0xf881);
-    sl.Emit32((LARGE_OBJECT_SIZE - 256)/sizeof(WCHAR));
+    sl.Emit32((lohSizeThreshold - 256)/sizeof(WCHAR));
 
     // jae noLock - seems tempting to jump to noAlloc, but we haven't taken the lock yet
     sl.X86EmitCondJump(noLock, X86CondCode::kJAE);
@@ -638,14 +638,23 @@ ILStubCache::ILStubCacheTraits::count_t ILStubCache::ILStubCacheTraits::Hash(_In
     LIMITED_METHOD_CONTRACT;
 
     size_t cb = key->m_cbSizeOfBlob - sizeof(ILStubHashBlobBase);
-    int   hash = 0;
+    size_t hash = 5381;
 
-    for (size_t i = 0; i < cb; i++)
+    // The blob data begins immediately after the size_t blob size, so it is suitably
+    // aligned to consume a word at a time. The signature portion at the end of the
+    // blob is the only part that is not a multiple of the word size.
+    const BYTE* pb = key->m_rgbBlobData;
+    for (/**/; cb >= sizeof(size_t); pb += sizeof(size_t), cb -= sizeof(size_t))
     {
-        hash = _rotl(hash, 1) + key->m_rgbBlobData[i];
+        hash = ((hash << 5) + hash) ^ *(const size_t*)pb;
     }
 
-    return hash;
+    for (/**/; cb > 0; pb++, cb--)
+    {
+        hash = ((hash << 5) + hash) ^ *pb;
+    }
+
+    return (count_t)hash;
 }
 
 bool ILStubCache::ILStubCacheTraits::Equals(_In_ key_t lhs, _In_ key_t rhs)
@@ -282,16 +282,61 @@ namespace
 
     private:
         friend struct InteropLibImports::RuntimeCallContext;
+
+        // Bucket arrays replaced when the hash map grows. Lock-free readers may
+        // still be scanning a replaced array, so its deletion is deferred until
+        // the next GC suspension - which any cooperative mode reader blocks.
+        struct RetiredTable
+        {
+            Element* Table;
+            RetiredTable* Next;
+        };
+
+        // Contexts removed from the hash map whose destruction must likewise
+        // wait out lock-free readers that may still dereference them.
+        struct RetiredContext
+        {
+            ExternalObjectContext* Context;
+            RetiredContext* Next;
+        };
+
         SHash<Traits> _hashMap;
         SimpleRWLock _lock;
         ExtObjCxtRefCache* _refCache;
 
+        // Mutation version of the hash map. Odd while a mutation is in flight.
+        // See TryFindWithoutLock for the read protocol.
+        LONG _version;
+        RetiredTable* _retiredTables;
+        RetiredContext* _retiredContexts;
+
         ExtObjCxtCache()
             : _lock(COOPERATIVE, LOCK_TYPE_DEFAULT)
             , _refCache(GetAppDomain()->GetRCWRefCache())
+            , _version(0)
+            , _retiredTables(NULL)
+            , _retiredContexts(NULL)
         { }
         ~ExtObjCxtCache() = default;
 
+        // Writers bracket every mutation of the hash map with these calls, leaving
+        // the version odd while the mutation is in flight. Writers are serialized
+        // by the writer lock or by the runtime being suspended, so the increments
+        // never race with each other.
+        void BeginUpdate()
+        {
+            LIMITED_METHOD_CONTRACT;
+            LONG v = InterlockedIncrement(&_version);
+            _ASSERTE((v & 1) == 1);
+        }
+
+        void EndUpdate()
+        {
+            LIMITED_METHOD_CONTRACT;
+            LONG v = InterlockedIncrement(&_version);
+            _ASSERTE((v & 1) == 0);
+        }
+
     public:
 #if _DEBUG
         bool IsLockHeld()
@@ -435,6 +480,59 @@ namespace
             RETURN gc.arrRef;
         }
 
+        // Attempt to find the context for the given key without taking the lock.
+        // Returns false when a mutation raced with the lookup, in which case the
+        // caller should fall back to Find() under the reader lock. A true return
+        // with a NULL result is an authoritative miss.
+        //
+        // This is a sequence lock over the hash map. Writers bump _version to an
+        // odd value around every mutation, so an even version that is unchanged
+        // across the read brackets a quiescent map. The version is validated after
+        // capturing the table snapshot but before dereferencing it, so a reader can
+        // never probe a mismatched table/size pair, and bucket arrays replaced by
+        // growth are only deleted during a GC suspension, which this cooperative
+        // mode reader blocks.
+        bool TryFindWithoutLock(_In_ const ExternalObjectContext::Key& key, _Out_ ExternalObjectContext** result)
+        {
+            CONTRACTL
+            {
+                NOTHROW;
+                GC_NOTRIGGER;
+                MODE_COOPERATIVE;
+                PRECONDITION(result != NULL);
+            }
+            CONTRACTL_END;
+
+            // Forbid the GC from messing with the hash table.
+            GCX_FORBID();
+
+            *result = NULL;
+
+            LONG version = VolatileLoad(&_version);
+            if ((version & 1) != 0)
+                return false;
+
+            SHash<Traits>::count_t tableSize;
+            SHash<Traits>::PTR_element_t table = _hashMap.GetTableSnapshot(&tableSize);
+
+            // Confirm no mutation was published between the version read and the
+            // snapshot so the table/size pair is known to be consistent.
+            MemoryBarrier();
+            if (VolatileLoad(&_version) != version)
+                return false;
+
+            const Element* elem = _hashMap.LookupInTable(table, tableSize, key);
+            ExternalObjectContext* cxt = (elem != NULL) ? *elem : NULL;
+
+            // Confirm the map was quiescent for the whole probe.
+            MemoryBarrier();
+            if (VolatileLoad(&_version) != version)
+                return false;
+
+            *result = cxt;
+            return true;
+        }
+
         ExternalObjectContext* Find(_In_ const ExternalObjectContext::Key& key)
         {
             CONTRACT(ExternalObjectContext*)
@@ -468,7 +566,34 @@ namespace
             }
             CONTRACT_END;
 
+            // Growth is performed in phases so that a replaced bucket array can be
+            // retired for deferred deletion rather than freed while a lock-free
+            // reader may still be scanning it. The allocating phase runs before the
+            // version is bumped because it can throw; the publishing phase cannot.
+            SHash<Traits>::count_t newTableSize;
+            Element* newTable;
+            NewHolder<RetiredTable> retiredNode;
+            if (_hashMap.PrepareGrowth(&newTable, &newTableSize))
+            {
+                retiredNode = new (nothrow) RetiredTable();
+                if (retiredNode == NULL)
+                {
+                    // The new table was never published so no reader can see it.
+                    _hashMap.DeleteOldTable(newTable);
+                    ThrowOutOfMemory();
+                }
+            }
+
+            BeginUpdate();
+            if (retiredNode != NULL)
+            {
+                retiredNode->Table = _hashMap.ReplaceTable(newTable, newTableSize);
+                retiredNode->Next = _retiredTables;
+                _retiredTables = retiredNode.Extract();
+            }
             _hashMap.Add(cxt);
+            EndUpdate();
+
             RETURN cxt;
         }
 
@@ -514,7 +639,79 @@ namespace
             }
             CONTRACTL_END;
 
+            BeginUpdate();
             _hashMap.Remove(cxt->GetKey());
+            EndUpdate();
+        }
+
+        // Take ownership of a context that was just removed from the cache.
+        // Removal only makes the context unreachable for new lookups; a lock-free
+        // reader that is already inside the bucket array may still call GetKey()
+        // on it, so it cannot be destroyed inline. It is destroyed alongside the
+        // retired bucket arrays at the next GC suspension.
+        void Retire(_In_ ExternalObjectContext* cxt)
+        {
+            CONTRACTL
+            {
+                NOTHROW;
+                GC_NOTRIGGER;
+                MODE_ANY;
+                PRECONDITION(cxt != NULL);
+                PRECONDITION(IsLockHeld() && GetThread()->PreemptiveGCDisabled());
+            }
+            CONTRACTL_END;
+
+            RetiredContext* retired = new (nothrow) RetiredContext{ cxt, _retiredContexts };
+            if (retired == NULL)
+            {
+                // Without a list node the context cannot be tracked for deferred
+                // destruction. Leak it - a reader may still hold a pointer to it,
+                // so destroying it here is not an option.
+                STRESS_LOG1(LF_INTEROP, LL_INFO100, "EOC retire failed, leaking: 0x%p\n", cxt);
+                return;
+            }
+
+            _retiredContexts = retired;
+        }
+
+        // Delete bucket arrays and destroy contexts retired by growth or removal.
+        // Only safe once no lock-free reader can still reference them, which the
+        // runtime suspension for a GC guarantees since all readers run in
+        // cooperative mode.
+        void FreeRetiredTables()
+        {
+            CONTRACTL
+            {
+                NOTHROW;
+                GC_NOTRIGGER;
+                MODE_ANY;
+                PRECONDITION(GCHeapUtilities::IsGCInProgress()); // GC is in progress and the runtime is suspended
+            }
+            CONTRACTL_END;
+
+            RetiredTable* curr = _retiredTables;
+            _retiredTables = NULL;
+            while (curr != NULL)
+            {
+                RetiredTable* next = curr->Next;
+                _hashMap.DeleteOldTable(curr->Table);
+                delete curr;
+                curr = next;
+            }
+
+            RetiredContext* currCxt = _retiredContexts;
+            _retiredContexts = NULL;
+            while (currCxt != NULL)
+            {
+                RetiredContext* next = currCxt->Next;
+
+                // Collection notification is requested since these contexts come
+                // from failed activations and never reach the typical notification
+                // point before finalization. See ExternalWrapperResultHolder.
+                InteropLib::Com::DestroyWrapperForExternal(currCxt->Context, /* notifyIsBeingCollected */ true);
+                delete currCxt;
+                currCxt = next;
+            }
         }
 
         void DetachNotPromotedEOCs()
@@ -831,9 +1028,15 @@ namespace
             bool tryRemove = false;
             {
                 // Perform a quick look up to determine if we know of the object and if
-                // we need to perform a more expensive cleanup operation below.
-                ExtObjCxtCache::ReaderLock lock(cache);
-                extObjCxt = cache->Find(cacheKey);
+                // we need to perform a more expensive cleanup operation below. Repeated
+                // wraps of the same object dominate this path, so the lock-free lookup
+                // is attempted first and the reader lock is only taken when a writer
+                // raced with it.
+                if (!cache->TryFindWithoutLock(cacheKey, &extObjCxt))
+                {
+                    ExtObjCxtCache::ReaderLock lock(cache);
+                    extObjCxt = cache->Find(cacheKey);
+                }
                 objectFound = extObjCxt != NULL;
                 tryRemove = objectFound && extObjCxt->IsSet(ExternalObjectContext::Flags_Detached);
             }
@@ -995,9 +1198,14 @@ namespace
                     if (!interopInfo->TrySetExternalComObjectContext((void**)extObjCxt))
                     {
                         // Failed to set the context; one must already exist.
-                        // Remove from the cache above as well.
+                        // Remove from the cache above as well. The holder must not
+                        // destroy the context inline - a lock-free reader may still
+                        // be scanning the bucket array it was removed from - so the
+                        // cache takes ownership and defers destruction to the next
+                        // GC suspension.
                         ExtObjCxtCache::WriterLock lock(cache);
                         cache->Remove(resultHolder.GetContext());
+                        cache->Retire(resultHolder.DetachContext());
 
                         COMPlusThrow(kNotSupportedException);
                     }
@@ -2067,7 +2275,13 @@ void ComWrappersNative::AfterRefCountedHandleCallbacks()
 
     ExtObjCxtCache* cache = ExtObjCxtCache::GetInstanceNoThrow();
     if (cache != NULL)
+    {
         cache->DetachNotPromotedEOCs();
+
+        // The runtime is suspended, so no lock-free reader can be scanning a
+        // bucket array retired by cache growth - reclaim them now.
+        cache->FreeRetiredTables();
+    }
 }
 
 #endif // FEATURE_COMWRAPPERS
@@ -1778,8 +1778,11 @@ HCIMPL1_RAW(StringObject*, AllocateString_MP_FastPortable, DWORD stringLength)
     _ASSERTE(GCHeapUtilities::UseThreadAllocationContexts());
 
     // Instead of doing elaborate overflow checks, we just limit the number of elements. This will avoid all overflow
-    // problems, as well as making sure big string objects are correctly allocated in the big object heap.
-    if (stringLength >= (LARGE_OBJECT_SIZE - 256) / sizeof(WCHAR))
+    // problems, as well as making sure big string objects are correctly allocated in the big object heap. The first
+    // check is a compile-time constant so small strings pay for nothing; the second one picks up a lowered
+    // GCLOHThreshold.
+    if (stringLength >= (MIN_LOH_SIZE_THRESHOLD - 256) / sizeof(WCHAR) &&
+        stringLength >= (GCHeapUtilities::GetGCHeap()->GetLOHThreshold() - 256) / sizeof(WCHAR))
     {
         // Tail call to the slow helper
         return HCCALL1(FramedAllocateString, stringLength);
@@ -1918,6 +1921,16 @@ HCIMPL2_RAW(Object*, JIT_NewArr1VC_MP_FastPortable, CORINFO_CLASS_HANDLE arrayMT
     _ASSERTE(alignedTotalSize >= totalSize);
     totalSize = alignedTotalSize;
 
+    // A lowered GCLOHThreshold can be below the largest allocation quantum, in which case
+    // fitting in the allocation context no longer implies the array belongs on the small
+    // object heap, so check explicitly. The first comparison is a compile-time constant
+    // and fails for all normally sized arrays.
+    if (totalSize >= MIN_LOH_SIZE_THRESHOLD && totalSize >= GCHeapUtilities::GetGCHeap()->GetLOHThreshold())
+    {
+        // Tail call to the slow helper
+        return HCCALL2(JIT_NewArr1, arrayMT, size);
+    }
+
     BYTE *allocPtr = allocContext->alloc_ptr;
     _ASSERTE(allocPtr <= allocContext->alloc_limit);
     if (totalSize > static_cast<SIZE_T>(allocContext->alloc_limit - allocPtr))
@@ -1950,10 +1963,13 @@ HCIMPL2_RAW(Object*, JIT_NewArr1OBJ_MP_FastPortable, CORINFO_CLASS_HANDLE arrayM
 
     _ASSERTE(GCHeapUtilities::UseThreadAllocationContexts());
 
-    // Make sure that the total size cannot reach LARGE_OBJECT_SIZE, which also allows us to avoid overflow checks. The
-    // "256" slack is to cover the array header size and round-up, using a constant value here out of laziness.
+    // Make sure that the total size cannot reach the LOH threshold, which also allows us to avoid overflow checks. The
+    // "256" slack is to cover the array header size and round-up, using a constant value here out of laziness. The
+    // first check is a compile-time constant so small arrays pay for nothing; the second one picks up a lowered
+    // GCLOHThreshold.
     SIZE_T componentCount = static_cast<SIZE_T>(size);
-    if (componentCount >= static_cast<SIZE_T>((LARGE_OBJECT_SIZE - 256) / sizeof(void *)))
+    if (componentCount >= static_cast<SIZE_T>((MIN_LOH_SIZE_THRESHOLD - 256) / sizeof(void *)) &&
+        componentCount >= static_cast<SIZE_T>((GCHeapUtilities::GetGCHeap()->GetLOHThreshold() - 256) / sizeof(void *)))
     {
         // Tail call to the slow helper
         return HCCALL2(JIT_NewArr1, arrayMT, size);
@@ -2138,6 +2154,16 @@ HCIMPL2_RAW(Object*, JIT_Box_MP_FastPortable, CORINFO_CLASS_HANDLE type, void* u
     SIZE_T size = methodTable->GetBaseSize();
     _ASSERTE(size % DATA_ALIGNMENT == 0);
 
+    // A lowered GCLOHThreshold can be below the largest allocation quantum, in which case
+    // fitting in the allocation context no longer implies the box belongs on the small
+    // object heap, so check explicitly. The first comparison is a compile-time constant
+    // and fails for all normally sized value types.
+    if (size >= MIN_LOH_SIZE_THRESHOLD && size >= GCHeapUtilities::GetGCHeap()->GetLOHThreshold())
+    {
+        // Tail call to the slow helper
+        return HCCALL2(JIT_Box, type, unboxedData);
+    }
+
     BYTE *allocPtr = allocContext->alloc_ptr;
     _ASSERTE(allocPtr <= allocContext->alloc_limit);
     if (size > static_cast<SIZE_T>(allocContext->alloc_limit - allocPtr))
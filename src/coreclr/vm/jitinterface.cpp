@@ -5776,7 +5776,8 @@ CorInfoHelpFunc CEEInfo::getNewHelperStatic(MethodTable * pMT, bool * pHasSideEf
         _ASSERTE(helper == CORINFO_HELP_NEWFAST);
     }
     else
-    if ((pMT->GetBaseSize() >= LARGE_OBJECT_SIZE) ||
+    if ((pMT->GetBaseSize() >= MIN_LOH_SIZE_THRESHOLD &&
+         pMT->GetBaseSize() >= GCHeapUtilities::GetGCHeap()->GetLOHThreshold()) ||
         hasFinalizer)
     {
         // Use slow helper
@@ -10959,7 +10960,7 @@ void CEEJitInfo::CompressDebugInfo()
             m_inlineTreeNodes, m_numInlineTreeNodes,
             m_richOffsetMappings, m_numRichOffsetMappings,
             writeFlagByte,
-            m_pMethodBeingCompiled->GetLoaderAllocator()->GetLowFrequencyHeap());
+            m_pMethodBeingCompiled->GetLoaderAllocator());
 
         m_CodeHeaderRW->SetDebugInfo(pDebugInfo);
     }
@@ -12123,7 +12124,11 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    // Tier-0 code is placed apart from optimized code, which stays hot for the process
+    // lifetime and benefits from dense packing.
+    bool isHotCode = !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+
+    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, isHotCode, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
                           , &m_pRealCodeHeader
 #ifdef FEATURE_EH_FUNCLETS
                           , m_totalUnwindInfos
@@ -12275,6 +12280,30 @@ void CEEJitInfo::setEHinfo (
         SetHasCachedTypeHandle(pEHClause);
         LOG((LF_EH, LL_INFO1000000, "  CachedTypeHandle: 0x%08x  ->  %p\n",        clause->ClassToken,    pEHClause->TypeHandle));
     }
+    else if (IsTypedHandler(pEHClause) &&
+        (clause->ClassToken != mdTokenNil) &&
+        !m_pMethodBeingCompiled->HasClassOrMethodInstantiation())
+    {
+        // For typed clauses whose catch type cannot depend on a generic context,
+        // cache the resolved type handle now if the type is already loaded, so that
+        // exception dispatch does not re-resolve the token on every throw (see
+        // EEJitManager::ResolveEHClause). The load is not forced here: a type load
+        // failure must surface at dispatch time rather than at compile time, and
+        // compiling a method should not load types it may never catch. This caching
+        // is only safe before the code is published - once other threads can
+        // enumerate the clause table, the token may not be overwritten.
+        SigTypeContext typeContext(m_pMethodBeingCompiled);
+        TypeHandle typeHnd = ClassLoader::LoadTypeDefOrRefOrSpecThrowing(
+            m_pMethodBeingCompiled->GetModule(), clause->ClassToken, &typeContext,
+            ClassLoader::ReturnNullIfNotFound, ClassLoader::FailIfUninstDefOrRef,
+            ClassLoader::DontLoadTypes);
+        if (!typeHnd.IsNull())
+        {
+            pEHClause->TypeHandle = (void*)typeHnd.AsPtr();
+            SetHasCachedTypeHandle(pEHClause);
+            LOG((LF_EH, LL_INFO1000000, "  CachedTypeHandle: 0x%08x  ->  %p\n",    clause->ClassToken,    pEHClause->TypeHandle));
+        }
+    }
 
     EE_TO_JIT_TRANSITION();
 }
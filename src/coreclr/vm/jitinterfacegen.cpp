@@ -82,12 +82,16 @@ void InitJITHelpers1()
 
             ECall::DynamicallyAssignFCallImpl(GetEEFuncEntryPoint(AllocateString_MP_FastPortable), ECall::FastAllocateString);
         }
-        else
+        else if (GCHeapUtilities::GetGCHeap()->GetLOHThreshold() >= LARGE_OBJECT_SIZE)
         {
             // Replace the 1p slow allocation helpers with faster version
             //
             // When we're running Workstation GC on a single proc box we don't have
             // InlineGetThread versions because there is no need to call GetThread
+            //
+            // These assembly helpers hardcode the LARGE_OBJECT_SIZE cutoff, so they
+            // cannot be used when GCLOHThreshold has been lowered below it; in that
+            // case we keep the default framed helpers.
             SetJitHelperFunction(CORINFO_HELP_NEWSFAST, JIT_TrialAllocSFastSP);
             SetJitHelperFunction(CORINFO_HELP_NEWSFAST_ALIGN8, JIT_TrialAllocSFastSP);
             SetJitHelperFunction(CORINFO_HELP_BOX, JIT_BoxFastUP);
@@ -364,6 +364,7 @@ public:
 
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
+    void * m_pLastUsedHotCodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
     void * m_pJumpStubCache;
 
@@ -4928,12 +4928,36 @@ MethodTable::FindEncodedMapDispatchEntry(
 
     MethodTable * dispatchTokenType = AppDomain::GetCurrentDomain()->LookupType(typeID);
 
+    // The encoded map groups its entries by dispatch map type ID in ascending
+    // order, and those IDs index this type's interface map. Resolve the
+    // dispatch token type against the interface map once up front so that the
+    // exact match scan below can be skipped entirely when this type does not
+    // implement the interface (common when walking up the inheritance chain
+    // from FindDispatchEntry), and otherwise stopped as soon as it has decoded
+    // past the last entry group that can possibly match.
+    INT32 lastMatchInterfaceNum = -1;
+    {
+        InterfaceMapIterator intIt = IterateInterfaceMap();
+        while (intIt.Next())
+        {
+            if (intIt.CurrentInterfaceMatches(this, dispatchTokenType))
+            {
+                lastMatchInterfaceNum = (INT32)intIt.GetIndex();
+            }
+        }
+    }
+
     // Search for an exact type match.
+    if (lastMatchInterfaceNum >= 0)
     {
         DispatchMap::EncodedMapIterator it(this);
         for (; it.IsValid(); it.Next())
         {
             DispatchMapEntry * pCurEntry = it.Entry();
+            if ((INT32)pCurEntry->GetTypeID().GetInterfaceNum() > lastMatchInterfaceNum)
+            {
+                break;
+            }
             if (pCurEntry->GetSlotNumber() == slotNumber)
             {
                 if (DispatchMapTypeMatchesMethodTable(pCurEntry->GetTypeID(), dispatchTokenType))
@@ -805,13 +805,19 @@ STRINGREF StringObject::NewString(LPCUTF8 psz)
     if (length == 0) {
         return GetEmptyString();
     }
-    CQuickBytes qb;
-    WCHAR* pwsz = (WCHAR*) qb.AllocThrows((length) * sizeof(WCHAR));
-    length = MultiByteToWideChar(CP_UTF8, 0, psz, length, pwsz, length);
-    if (length == 0) {
+    // Compute the UTF-16 length first so the characters can be converted directly into the new
+    // string's buffer, instead of being converted into a temporary buffer and copied again.
+    int cWsz = MultiByteToWideChar(CP_UTF8, 0, psz, length, NULL, 0);
+    if (cWsz == 0) {
+        COMPlusThrow(kArgumentException, W("Arg_InvalidUTF8String"));
+    }
+    STRINGREF pString = AllocateString(cWsz);
+    cWsz = MultiByteToWideChar(CP_UTF8, 0, psz, length, pString->GetBuffer(), cWsz);
+    if (cWsz == 0) {
         COMPlusThrow(kArgumentException, W("Arg_InvalidUTF8String"));
     }
-    return NewString(pwsz, length);
+    _ASSERTE(pString->GetBuffer()[cWsz] == 0);
+    return pString;
 }
 
 STRINGREF StringObject::NewString(LPCUTF8 psz, int cBytes)
@@ -831,16 +837,19 @@ STRINGREF StringObject::NewString(LPCUTF8 psz, int cBytes)
     if (cBytes == 0) {
         return GetEmptyString();
     }
-    int cWszBytes = 0;
-    if (!ClrSafeInt<int>::multiply(cBytes, sizeof(WCHAR), cWszBytes))
-        COMPlusThrowOM();
-    CQuickBytes qb;
-    WCHAR* pwsz = (WCHAR*) qb.AllocThrows(cWszBytes);
-    int length = MultiByteToWideChar(CP_UTF8, 0, psz, cBytes, pwsz, cBytes);
-    if (length == 0) {
+    // Compute the UTF-16 length first so the characters can be converted directly into the new
+    // string's buffer, instead of being converted into a temporary buffer and copied again.
+    int cWsz = MultiByteToWideChar(CP_UTF8, 0, psz, cBytes, NULL, 0);
+    if (cWsz == 0) {
+        COMPlusThrow(kArgumentException, W("Arg_InvalidUTF8String"));
+    }
+    STRINGREF pString = AllocateString(cWsz);
+    cWsz = MultiByteToWideChar(CP_UTF8, 0, psz, cBytes, pString->GetBuffer(), cWsz);
+    if (cWsz == 0) {
         COMPlusThrow(kArgumentException, W("Arg_InvalidUTF8String"));
     }
-    return NewString(pwsz, length);
+    _ASSERTE(pString->GetBuffer()[cWsz] == 0);
+    return pString;
 }
 
 //
@@ -160,6 +160,53 @@ void CallFClose(FILE* file)
 
 typedef Holder<FILE*, DoNothing, CallFClose> FILEHolder;
 
+// Binary PGO data file format (see WritePgoDataBinary/ReadPgoDataBinary):
+//
+//   PgoBinaryFileHeader
+//   methodCount * {
+//       PgoBinaryMethodHeader
+//       schemaCount * PgoBinarySchemaRecord
+//       cbData bytes of per-entry payload, laid out in schema order:
+//           FourByte                - uint32_t
+//           EightByte               - uint64_t
+//           TypeHandle/MethodHandle - uint32_t byte count followed by the same
+//               UTF-8 name string the text format stores, or one of the
+//               PgoBinaryHandle* sentinels with no payload
+//   }
+//
+// The format is versioned via PgoBinaryFileVersion. Readers reject a file whose
+// magic or version does not match and methods whose payload does not parse are
+// skipped, mirroring the text reader's tolerance for malformed entries.
+struct PgoBinaryFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t methodCount;
+    uint32_t reserved;
+};
+
+struct PgoBinaryMethodHeader
+{
+    uint32_t codehash;
+    uint32_t methodhash;
+    uint32_t ilSize;
+    uint32_t schemaCount;
+    uint32_t cbData;
+};
+
+struct PgoBinarySchemaRecord
+{
+    int32_t kind;
+    int32_t ilOffset;
+    int32_t count;
+    int32_t other;
+};
+
+static const uint32_t PgoBinaryFileMagic     = 0x324F4750; // 'PGO2'
+static const uint32_t PgoBinaryFileVersion   = 1;
+static const uint32_t PgoBinaryHandleNull    = 0xFFFFFFFF;
+static const uint32_t PgoBinaryHandleUnknown = 0xFFFFFFFE;
+
 void PgoManager::WritePgoData()
 {
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, JitInstrumentationDataVerbose))
@@ -214,6 +261,12 @@ void PgoManager::WritePgoData()
 
     FILEHolder fileHolder(pgoDataFile);
 
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PGODataBinaryFormat) != 0)
+    {
+        WritePgoDataBinary(pgoDataFile);
+        return;
+    }
+
     fprintf(pgoDataFile, s_FileHeaderString, pgoDataCount);
 
     EnumeratePGOHeaders([pgoDataFile](HeaderList *pgoData)
@@ -330,6 +383,182 @@ void PgoManager::WritePgoData()
 
     fprintf(pgoDataFile, s_FileTrailerString);
 }
+
+void PgoManager::WritePgoDataBinary(FILE* pgoDataFile)
+{
+    // The method count is not known until enumeration completes (methods with an
+    // invalid schema are skipped), so the header is rewritten at the end.
+    PgoBinaryFileHeader fileHeader = { PgoBinaryFileMagic, PgoBinaryFileVersion, 0, 0 };
+    if (fwrite(&fileHeader, sizeof(fileHeader), 1, pgoDataFile) != 1)
+    {
+        return;
+    }
+
+    uint32_t methodsWritten = 0;
+    EnumeratePGOHeaders([pgoDataFile, &methodsWritten](HeaderList *pgoData)
+    {
+        int32_t schemaItems;
+        if (!CountInstrumentationDataSize(pgoData->header.GetData(), pgoData->header.SchemaSizeMax(), &schemaItems))
+        {
+            _ASSERTE(!"Invalid instrumentation schema");
+            return true;
+        }
+
+        uint8_t* data = pgoData->header.GetData();
+
+        StackSArray<PgoBinarySchemaRecord> schemaRecords;
+        StackSArray<uint8_t> payload;
+
+        auto appendBytes = [&payload](const void* bytes, size_t cb)
+        {
+            const uint8_t* pb = (const uint8_t*)bytes;
+            for (size_t i = 0; i < cb; i++)
+            {
+                payload.Append(pb[i]);
+            }
+        };
+
+        auto appendString = [&appendBytes](const char* utf8)
+        {
+            uint32_t cbString = (uint32_t)strlen(utf8);
+            appendBytes(&cbString, sizeof(cbString));
+            appendBytes(utf8, cbString);
+        };
+
+        auto appendSentinel = [&appendBytes](uint32_t sentinel)
+        {
+            appendBytes(&sentinel, sizeof(sentinel));
+        };
+
+        auto lambda = [&] (const ICorJitInfo::PgoInstrumentationSchema &schema)
+        {
+            PgoBinarySchemaRecord record;
+            record.kind = (int32_t)schema.InstrumentationKind;
+            record.ilOffset = schema.ILOffset;
+            record.count = schema.Count;
+            record.other = schema.Other;
+            schemaRecords.Append(record);
+
+            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+            {
+                size_t entryOffset = schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind);
+
+                switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+                {
+                    case ICorJitInfo::PgoInstrumentationKind::None:
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                        appendBytes(data + entryOffset, sizeof(uint32_t));
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                        appendBytes(data + entryOffset, sizeof(uint64_t));
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+                        {
+                            intptr_t thData = *(intptr_t*)(data + entryOffset);
+                            if (thData == 0)
+                            {
+                                appendSentinel(PgoBinaryHandleNull);
+                            }
+                            else if (ICorJitInfo::IsUnknownHandle(thData))
+                            {
+                                appendSentinel(PgoBinaryHandleUnknown);
+                            }
+                            else
+                            {
+                                TypeHandle th = TypeHandle::FromPtr((void*)thData);
+                                StackSString ss;
+                                TypeString::AppendType(ss, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                                if (ss.GetCount() > 8192)
+                                {
+                                    appendSentinel(PgoBinaryHandleUnknown);
+                                }
+                                else
+                                {
+                                    appendString(ss.GetUTF8());
+                                }
+                            }
+                            break;
+                        }
+                    case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+                        {
+                            intptr_t mdData = *(intptr_t*)(data + entryOffset);
+                            if (mdData == 0)
+                            {
+                                appendSentinel(PgoBinaryHandleNull);
+                            }
+                            else if (ICorJitInfo::IsUnknownHandle(mdData))
+                            {
+                                appendSentinel(PgoBinaryHandleUnknown);
+                            }
+                            else
+                            {
+                                MethodDesc* md = reinterpret_cast<MethodDesc*>(mdData);
+                                SString garbage1, tMethodName, garbage2;
+                                md->GetMethodInfo(garbage1, tMethodName, garbage2);
+                                StackSString tTypeName;
+                                TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                                if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
+                                {
+                                    appendSentinel(PgoBinaryHandleUnknown);
+                                }
+                                else
+                                {
+                                    // Same composite encoding as the text format:
+                                    // MethodName|@|fully_qualified_type_name
+                                    StackSString composite;
+                                    composite.AppendUTF8(tMethodName.GetUTF8());
+                                    composite.AppendUTF8("|@|");
+                                    composite.AppendUTF8(tTypeName.GetUTF8());
+                                    appendString(composite.GetUTF8());
+                                }
+                            }
+                            break;
+                        }
+                    default:
+                        break;
+                }
+            }
+            return true;
+        };
+
+        if (!ReadInstrumentationSchemaWithLayout(pgoData->header.GetData(), pgoData->header.SchemaSizeMax(), pgoData->header.countsOffset, lambda))
+        {
+            return true;
+        }
+
+        PgoBinaryMethodHeader methodHeader;
+        methodHeader.codehash = pgoData->header.codehash;
+        methodHeader.methodhash = pgoData->header.methodhash;
+        methodHeader.ilSize = pgoData->header.ilSize;
+        methodHeader.schemaCount = (uint32_t)schemaRecords.GetCount();
+        methodHeader.cbData = (uint32_t)payload.GetCount();
+
+        if (fwrite(&methodHeader, sizeof(methodHeader), 1, pgoDataFile) != 1)
+        {
+            return false;
+        }
+        if ((methodHeader.schemaCount != 0) &&
+            (fwrite(schemaRecords.GetElements(), sizeof(PgoBinarySchemaRecord), methodHeader.schemaCount, pgoDataFile) != methodHeader.schemaCount))
+        {
+            return false;
+        }
+        if ((methodHeader.cbData != 0) &&
+            (fwrite(payload.GetElements(), 1, methodHeader.cbData, pgoDataFile) != methodHeader.cbData))
+        {
+            return false;
+        }
+
+        methodsWritten++;
+        return true;
+    });
+
+    fileHeader.methodCount = methodsWritten;
+    if (fseek(pgoDataFile, 0, SEEK_SET) == 0)
+    {
+        fwrite(&fileHeader, sizeof(fileHeader), 1, pgoDataFile);
+    }
+}
 #endif // DACCESS_COMPILE
 
 void ReadLineAndDiscard(FILE* file)
@@ -376,6 +605,22 @@ void PgoManager::ReadPgoData()
 
     FILEHolder fileHolder(pgoDataFile);
 
+    // Binary profile files are identified by their leading magic; anything else
+    // is handed to the text parser.
+    uint32_t binaryMagic = 0;
+    bool isBinaryFile = (fread(&binaryMagic, sizeof(binaryMagic), 1, pgoDataFile) == 1)
+        && (binaryMagic == PgoBinaryFileMagic);
+    if (fseek(pgoDataFile, 0, SEEK_SET) != 0)
+    {
+        return;
+    }
+
+    if (isBinaryFile)
+    {
+        ReadPgoDataBinary(pgoDataFile);
+        return;
+    }
+
     char     buffer[16384];
     unsigned maxIndex = 0;
 
@@ -586,41 +831,219 @@ void PgoManager::ReadPgoData()
 
         methods++;
 
-        UINT offsetOfActualInstrumentationData;
-        HRESULT hr = ComputeOffsetOfActualInstrumentationData(schemaElements.GetElements(), schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
-        if (FAILED(hr))
+        if (!AddPgoDataFromFile(codehash, methodhash, ilSize, schemaElements.GetElements(), schemaCount,
+                                methodInstrumentationData.GetElements(), methodInstrumentationData.GetCount()))
         {
-            continue;
+            return;
         }
-        UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
+        probes += schemaCount;
+    }
+}
 
-        // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
-        for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+void PgoManager::ReadPgoDataBinary(FILE* pgoDataFile)
+{
+    PgoBinaryFileHeader fileHeader;
+    if (fread(&fileHeader, sizeof(fileHeader), 1, pgoDataFile) != 1)
+    {
+        return;
+    }
+
+    if ((fileHeader.magic != PgoBinaryFileMagic) || (fileHeader.version != PgoBinaryFileVersion))
+    {
+        return;
+    }
+
+    for (uint32_t iMethod = 0; iMethod < fileHeader.methodCount; iMethod++)
+    {
+        PgoBinaryMethodHeader methodHeader;
+        if (fread(&methodHeader, sizeof(methodHeader), 1, pgoDataFile) != 1)
         {
-            schemaElements[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+            return;
         }
 
-        S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(methodInstrumentationData.GetCount());
-        if (allocationSize.IsOverflow())
+        StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaElements;
+        schemaElements.Preallocate((int)methodHeader.schemaCount);
+        ICorJitInfo::PgoInstrumentationSchema lastSchema = {};
+
+        bool failed = false;
+        for (uint32_t i = 0; i < methodHeader.schemaCount; i++)
         {
-            _ASSERTE(!"Unexpected overflow");
-            return;
+            PgoBinarySchemaRecord record;
+            if (fread(&record, sizeof(record), 1, pgoDataFile) != 1)
+            {
+                return;
+            }
+
+            ICorJitInfo::PgoInstrumentationSchema schema;
+            schema.InstrumentationKind = (ICorJitInfo::PgoInstrumentationKind)record.kind;
+            schema.ILOffset = record.ilOffset;
+            schema.Count = record.count;
+            schema.Other = record.other;
+
+            LayoutPgoInstrumentationSchema(lastSchema, &schema);
+            schemaElements[i] = schema;
+            lastSchema = schema;
         }
 
-        Header* methodData = (Header*)malloc(allocationSize.Value());
-        methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+        // The whole payload is read up front so that a method whose payload does
+        // not parse can be skipped without losing the file position.
+        StackSArray<uint8_t> payload;
+        payload.SetCount(methodHeader.cbData);
+        if (methodHeader.cbData != 0)
+        {
+            uint8_t* rawPayload = payload.OpenRawBuffer(methodHeader.cbData);
+            size_t cbRead = fread(rawPayload, 1, methodHeader.cbData, pgoDataFile);
+            payload.CloseRawBuffer();
+            if (cbRead != methodHeader.cbData)
+            {
+                return;
+            }
+        }
 
-        if (!WriteInstrumentationSchema(schemaElements.GetElements(), schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+        size_t payloadPos = 0;
+        auto readPayload = [&payload, &payloadPos, &methodHeader](void* dest, size_t cb)
+        {
+            if ((cb > methodHeader.cbData) || (payloadPos > methodHeader.cbData - cb))
+            {
+                return false;
+            }
+            memcpy(dest, payload.GetElements() + payloadPos, cb);
+            payloadPos += cb;
+            return true;
+        };
+
+        StackSArray<uint8_t> methodInstrumentationData;
+        for (uint32_t i = 0; !failed && (i < methodHeader.schemaCount); i++)
+        {
+            const ICorJitInfo::PgoInstrumentationSchema& schema = schemaElements[i];
+            COUNT_T entrySize = InstrumentationKindToSize(schema.InstrumentationKind);
+            COUNT_T maxSize = entrySize * schema.Count + (COUNT_T)schema.Offset;
+            methodInstrumentationData.SetCount(maxSize);
+
+            for (int32_t iEntry = 0; !failed && iEntry < schema.Count; iEntry++)
+            {
+                size_t entryOffset = schema.Offset + iEntry * entrySize;
+
+                switch(schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+                {
+                    case ICorJitInfo::PgoInstrumentationKind::None:
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                        {
+                            uint32_t val;
+                            if (!readPayload(&val, sizeof(val)))
+                            {
+                                failed = true;
+                                break;
+                            }
+                            uint8_t *rawBuffer = methodInstrumentationData.OpenRawBuffer(maxSize);
+                            *(uint32_t *)(rawBuffer + entryOffset) = val;
+                            methodInstrumentationData.CloseRawBuffer();
+                        }
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                        {
+                            uint64_t val;
+                            if (!readPayload(&val, sizeof(val)))
+                            {
+                                failed = true;
+                                break;
+                            }
+                            uint8_t *rawBuffer = methodInstrumentationData.OpenRawBuffer(maxSize);
+                            *(uint64_t *)(rawBuffer + entryOffset) = val;
+                            methodInstrumentationData.CloseRawBuffer();
+                        }
+                        break;
+                    case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+                    case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+                        {
+                            uint32_t cbString;
+                            if (!readPayload(&cbString, sizeof(cbString)))
+                            {
+                                failed = true;
+                                break;
+                            }
+
+                            INT_PTR ptrVal = 0;
+                            if ((cbString != PgoBinaryHandleNull) && (cbString != PgoBinaryHandleUnknown))
+                            {
+                                // As early type loading is likely problematic, simply drop the string into the data, and fix it up later
+                                char* tempString = (char*)malloc(cbString + 1);
+                                if ((tempString == NULL) || !readPayload(tempString, cbString))
+                                {
+                                    free(tempString);
+                                    failed = true;
+                                    break;
+                                }
+                                tempString[cbString] = '\0';
+
+                                ptrVal = (INT_PTR)tempString;
+                                ptrVal += 1; // Set low bit to indicate that this isn't actually a TypeHandle, but is instead a pointer
+                            }
+
+                            uint8_t *rawBuffer = methodInstrumentationData.OpenRawBuffer(maxSize);
+                            *(INT_PTR *)(rawBuffer + entryOffset) = ptrVal;
+                            methodInstrumentationData.CloseRawBuffer();
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        if (failed)
+        {
+            continue;
+        }
+
+        if (!AddPgoDataFromFile(methodHeader.codehash, methodHeader.methodhash, methodHeader.ilSize,
+                                schemaElements.GetElements(), methodHeader.schemaCount,
+                                methodInstrumentationData.GetElements(), methodInstrumentationData.GetCount()))
         {
-            _ASSERTE(!"Unable to write schema");
             return;
         }
+    }
+}
+
+bool PgoManager::AddPgoDataFromFile(unsigned codehash, unsigned methodhash, unsigned ilSize,
+                                    ICorJitInfo::PgoInstrumentationSchema* pSchema, unsigned schemaCount,
+                                    const uint8_t* pInstrumentationData, UINT32 cbInstrumentationData)
+{
+    UINT offsetOfActualInstrumentationData;
+    HRESULT hr = ComputeOffsetOfActualInstrumentationData(pSchema, schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
+    if (FAILED(hr))
+    {
+        return true;
+    }
+    UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
 
-        methodInstrumentationData.Copy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, methodInstrumentationData.Begin(), methodInstrumentationData.GetCount());
+    // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
+    for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+    {
+        pSchema[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+    }
 
-        s_textFormatPgoData.Add(methodData);
-        probes += schemaCount;
+    S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(cbInstrumentationData);
+    if (allocationSize.IsOverflow())
+    {
+        _ASSERTE(!"Unexpected overflow");
+        return false;
+    }
+
+    Header* methodData = (Header*)malloc(allocationSize.Value());
+    methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+
+    if (!WriteInstrumentationSchema(pSchema, schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+    {
+        _ASSERTE(!"Unable to write schema");
+        return false;
     }
+
+    memcpy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, pInstrumentationData, cbInstrumentationData);
+
+    s_textFormatPgoData.Add(methodData);
+    return true;
 }
 #endif // DACCESS_COMPILE
 
@@ -161,6 +161,11 @@ private:
 
     static void ReadPgoData();
     static void WritePgoData();
+    static void ReadPgoDataBinary(FILE* pgoDataFile);
+    static void WritePgoDataBinary(FILE* pgoDataFile);
+    static bool AddPgoDataFromFile(unsigned codehash, unsigned methodhash, unsigned ilSize,
+                                   ICorJitInfo::PgoInstrumentationSchema* pSchema, unsigned schemaCount,
+                                   const uint8_t* pInstrumentationData, UINT32 cbInstrumentationData);
 
 private:
 
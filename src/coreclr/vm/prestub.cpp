@@ -139,9 +139,10 @@ PCODE MethodDesc::DoBackpatch(MethodTable * pMT, MethodTable *pDispatchingMT, BO
                 Precode* pFuncPtrPrecode = pFuncPtrStubs->Lookup(this);
                 if (pFuncPtrPrecode != NULL)
                 {
-                    // If there is a funcptr precode to patch, we are done for this round.
-                    if (pFuncPtrPrecode->SetTargetInterlocked(pTarget))
-                        return pTarget;
+                    // Patch the funcptr precode and continue below, so that the remaining slot
+                    // classes are patched in the same round instead of each requiring another
+                    // trip through the prestub to get patched.
+                    pFuncPtrPrecode->SetTargetInterlocked(pTarget);
                 }
             }
 
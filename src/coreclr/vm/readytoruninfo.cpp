@@ -351,6 +351,15 @@ void ReadyToRunInfo::SetMethodDescForEntryPointInNativeImage(PCODE entryPoint, M
     }
     CONTRACTL_END;
 
+    // The map is initialized in async mode, so lookups are lock-free. An entry
+    // point is published here on every successful GetEntryPoint and methods
+    // sharing code hit this repeatedly during warmup, so only take the lock for
+    // a first-time publication.
+    if ((TADDR)m_entryPointToMethodDescMap.LookupValue(PCODEToPINSTR(entryPoint), (LPVOID)PCODEToPINSTR(entryPoint)) != (TADDR)INVALIDENTRY)
+    {
+        return;
+    }
+
     CrstHolder ch(&m_Crst);
 
     if ((TADDR)m_entryPointToMethodDescMap.LookupValue(PCODEToPINSTR(entryPoint), (LPVOID)PCODEToPINSTR(entryPoint)) == (TADDR)INVALIDENTRY)
@@ -1213,6 +1222,168 @@ done:
     return pEntryPoint;
 }
 
+namespace
+{
+    struct BackgroundMethodFixupWorkItem
+    {
+        ReadyToRunInfo * m_pInfo;
+        Thread *         m_pThread;
+    };
+}
+
+//
+// Resolve the fixup delay lists of all non-generic precompiled methods in the image.
+//
+// This is the same work that GetEntryPoint does lazily for each method on its first call
+// through the prestub, moved off the application's critical path onto a background thread.
+// Fixup cells are written at most once and readers use volatile loads (see
+// Module::FixupNativeEntry), so racing with concurrent first calls is safe. Failures are
+// deliberately ignored: a method whose fixups cannot be resolved here simply takes the
+// normal first-call path, which handles rejection of the precompiled code properly.
+//
+void ReadyToRunInfo::ResolveMethodFixupsInBackground()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    TADDR base = dac_cast<TADDR>(GetImage()->GetBase());
+    uint count = m_methodDefEntryPoints.GetCount();
+
+    for (uint index = 0; index < count; index++)
+    {
+        if (ReadyToRunCodeDisabled())
+            return;
+
+        EX_TRY
+        {
+            uint offset;
+            if (m_methodDefEntryPoints.TryGetAt(index, &offset))
+            {
+                uint id;
+                offset = m_nativeReader.DecodeUnsigned(offset, &id);
+
+                // Methods without a fixup list have nothing to resolve (see GetEntryPoint
+                // for the encoding of the entry point id).
+                if (id & 1)
+                {
+                    if (id & 2)
+                    {
+                        uint val;
+                        m_nativeReader.DecodeUnsigned(offset, &val);
+                        offset -= val;
+                    }
+
+                    // Do not bind precompiled P/Invoke stubs from here: that would
+                    // resolve their targets before the application has had a chance
+                    // to register a DllImportResolver. The cell stays unwritten and
+                    // the first call binds it, as in the multicore JIT path above.
+                    m_pModule->FixupDelayList(base + offset, FALSE /* mayUsePrecompiledNDirectMethods */);
+                }
+            }
+        }
+        EX_CATCH
+        {
+            // A missing dependency or a transient failure; the first call resolves or
+            // rejects this method instead.
+        }
+        EX_END_CATCH(SwallowAllExceptions)
+    }
+}
+
+DWORD WINAPI ReadyToRunInfo::BackgroundMethodFixupWorkerStatic(void * args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    BackgroundMethodFixupWorkItem * pWorkItem = (BackgroundMethodFixupWorkItem *)args;
+    Thread * pThread = pWorkItem->m_pThread;
+
+    if ((pThread != NULL) && pThread->HasStarted())
+    {
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        EX_TRY
+        {
+            GCX_PREEMP();
+
+            pWorkItem->m_pInfo->ResolveMethodFixupsInBackground();
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions)
+    }
+
+    if (pThread != NULL)
+    {
+        DestroyThread(pThread);
+    }
+
+    delete pWorkItem;
+
+    return 0;
+}
+
+//
+// If opted in via the ReadyToRunBackgroundFixups config switch, kick off a background
+// thread that pre-resolves this image's method fixup lists. Each module gets its own
+// worker, so modules loading concurrently are processed in parallel.
+//
+void ReadyToRunInfo::MaybeStartBackgroundMethodFixupWorker()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ReadyToRunBackgroundFixups) == 0)
+        return;
+
+    // Collectible assemblies may unload while the worker is still touching the image.
+    if (m_pModule->GetAssembly()->IsCollectible())
+        return;
+
+    if (m_methodDefEntryPoints.GetCount() == 0)
+        return;
+
+    NewHolder<BackgroundMethodFixupWorkItem> pWorkItem = new (nothrow) BackgroundMethodFixupWorkItem();
+    if (pWorkItem == NULL)
+        return;
+
+    pWorkItem->m_pInfo = this;
+
+    EX_TRY
+    {
+        Thread * pThread = SetupUnstartedThread();
+        pWorkItem->m_pThread = pThread;
+
+        if (pThread->CreateNewThread(0, BackgroundMethodFixupWorkerStatic, pWorkItem, W(".NET ReadyToRun Fixup Worker")))
+        {
+            pThread->StartThread();
+
+            // The worker owns the work item and the thread from here on
+            pWorkItem.SuppressRelease();
+        }
+        else
+        {
+            pThread->DecExternalCount(false);
+        }
+    }
+    EX_CATCH
+    {
+        // Failing to start the worker just means fixups stay lazy
+    }
+    EX_END_CATCH(SwallowAllExceptions)
+}
+
 void ReadyToRunInfo::MethodIterator::ParseGenericMethodSignatureAndRid(uint *pOffset, RID *pRid)
 {
     _ASSERTE(!m_genericParser.IsNull());
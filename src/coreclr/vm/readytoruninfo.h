@@ -169,6 +169,12 @@ public:
 
     PCODE GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig, BOOL fFixups);
 
+#ifndef DACCESS_COMPILE
+    // Optionally pre-resolve method fixup lists on a background thread (see
+    // the ReadyToRunBackgroundFixups config switch)
+    void MaybeStartBackgroundMethodFixupWorker();
+#endif
+
     PTR_MethodDesc GetMethodDescForEntryPoint(PCODE entryPoint);
     bool GetPgoInstrumentationData(MethodDesc * pMD, BYTE** pAllocatedMemory, ICorJitInfo::PgoInstrumentationSchema**ppSchema, UINT *pcSchema, BYTE** pInstrumentationData);
 
@@ -335,6 +341,11 @@ private:
 
     PTR_MethodDesc GetMethodDescForEntryPointInNativeImage(PCODE entryPoint);
     void SetMethodDescForEntryPointInNativeImage(PCODE entryPoint, PTR_MethodDesc methodDesc);
+
+#ifndef DACCESS_COMPILE
+    static DWORD WINAPI BackgroundMethodFixupWorkerStatic(void * args);
+    void ResolveMethodFixupsInBackground();
+#endif
     
     PTR_ReadyToRunCoreInfo GetComponentInfo() { return dac_cast<PTR_ReadyToRunCoreInfo>(&m_component); }
 };
@@ -391,6 +391,20 @@ public:
             m_dwFlags |= METHOD_INVOKE_NEEDS_ACTIVATION;
         }
 
+        // Classify the return shape once so that repeated invocations of methods returning
+        // void or an object reference can skip the per-call return type analysis. Computing
+        // HasRetBuffArg here also gets the return flags into the cached value.
+        {
+            TypeHandle retTH = (*m_ppNativeSig)->GetReturnTypeHandle();
+            CorElementType retType = retTH.GetSignatureCorElementType();
+            if (!HasRetBuffArg() &&
+                ((retType == ELEMENT_TYPE_VOID) ||
+                 ((retType != ELEMENT_TYPE_BYREF) && !retTH.IsValueType())))
+            {
+                m_dwFlags |= METHOD_INVOKE_SIMPLE_RETURN;
+            }
+        }
+
         (*m_ppNativeSig)->SetSizeOfArgStack(m_nSizeOfArgStack);
         _ASSERTE((*m_ppNativeSig)->GetSizeOfArgStack() == m_nSizeOfArgStack);
 
@@ -404,6 +418,12 @@ public:
         LIMITED_METHOD_CONTRACT;
         return (m_dwFlags & METHOD_INVOKE_NEEDS_ACTIVATION) != 0;
     }
+
+    BOOL HasSimpleReturn()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (m_dwFlags & METHOD_INVOKE_SIMPLE_RETURN) != 0;
+    }
 };
 
 FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
@@ -527,22 +547,30 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
 
     TypeHandle refReturnTargetTH;  // Valid only if retType == ELEMENT_TYPE_BYREF. Caches the TypeHandle of the byref target.
     BOOL fHasRetBuffArg = argit.HasRetBuffArg();
-    CorElementType retType = retTH.GetSignatureCorElementType();
-    BOOL hasValueTypeReturn = retTH.IsValueType() && retType != ELEMENT_TYPE_VOID;
-    _ASSERTE(hasValueTypeReturn || !fHasRetBuffArg); // only valuetypes are returned via a return buffer.
-    if (hasValueTypeReturn) {
-        gc.retVal = retTH.GetMethodTable()->Allocate();
-    }
-    else if (retType == ELEMENT_TYPE_BYREF)
-    {
-        refReturnTargetTH = retTH.AsTypeDesc()->GetTypeParam();
-
-        // If the target of the byref is a value type, we need to preallocate a boxed object to hold the managed return value.
-        if (refReturnTargetTH.IsValueType())
+    CorElementType retType = ELEMENT_TYPE_VOID;
+    BOOL hasValueTypeReturn = FALSE;
+
+    // Methods returning void or an object reference were classified when the arg iterator
+    // flags were cached, so repeated invocations skip the return type analysis below.
+    if (!argit.HasSimpleReturn())
+    {
+        retType = retTH.GetSignatureCorElementType();
+        hasValueTypeReturn = retTH.IsValueType() && retType != ELEMENT_TYPE_VOID;
+        _ASSERTE(hasValueTypeReturn || !fHasRetBuffArg); // only valuetypes are returned via a return buffer.
+        if (hasValueTypeReturn) {
+            gc.retVal = retTH.GetMethodTable()->Allocate();
+        }
+        else if (retType == ELEMENT_TYPE_BYREF)
         {
-            _ASSERTE(refReturnTargetTH.GetSignatureCorElementType() != ELEMENT_TYPE_VOID); // Managed Reflection layer has a bouncer for "ref void" returns.
-            hasRefReturnAndNeedsBoxing = TRUE;
-            gc.retVal = refReturnTargetTH.GetMethodTable()->Allocate();
+            refReturnTargetTH = retTH.AsTypeDesc()->GetTypeParam();
+
+            // If the target of the byref is a value type, we need to preallocate a boxed object to hold the managed return value.
+            if (refReturnTargetTH.IsValueType())
+            {
+                _ASSERTE(refReturnTargetTH.GetSignatureCorElementType() != ELEMENT_TYPE_VOID); // Managed Reflection layer has a bouncer for "ref void" returns.
+                hasRefReturnAndNeedsBoxing = TRUE;
+                gc.retVal = refReturnTargetTH.GetMethodTable()->Allocate();
+            }
         }
     }
 
@@ -1345,6 +1373,21 @@ static void PrepareMethodHelper(MethodDesc * pMD)
         if (pMD->IsPointingToPrestub())
             pMD->DoPrestub(NULL);
     }
+
+    // For exact instantiations, also pre-populate the generic dictionaries so the
+    // prepared code does not take generic handle lookup misses on first execution.
+    // Shared canonical instantiations are skipped; their dictionaries are only
+    // consulted through the exact types and methods using the shared code.
+    if (pMD->HasMethodInstantiation() && !pMD->IsSharedByGenericMethodInstantiations())
+    {
+        Dictionary::PrepopulateDictionary(pMD, NULL);
+    }
+
+    MethodTable * pMT = pMD->GetMethodTable();
+    if (pMT->HasInstantiation() && !pMT->IsSharedByGenericInstantiations())
+    {
+        Dictionary::PrepopulateDictionary(NULL, pMT);
+    }
 }
 
 // This method triggers a given method to be jitted. CoreCLR implementation of this method triggers jiting of the given method only.
@@ -1596,15 +1596,19 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Bound the remaining spin by the lock's adaptive limit, so that locks whose
+            // holders recently outlasted the spin window are not spun on at full length.
+            const DWORD lockSpinCount = min(spinCount, awareLock->GetSpinLimit());
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1613,6 +1617,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinSuccess();
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1624,8 +1629,11 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinSuccess();
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            awareLock->RecordSpinFailure();
             break;
         }
 
@@ -2639,7 +2647,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = min(g_SpinConstants.dwMonitorSpinCount, GetSpinLimit());
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -2652,8 +2660,11 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
                 }
                 if (acquiredLock)
                 {
+                    RecordSpinSuccess();
                     break;
                 }
+
+                RecordSpinFailure();
             }
 
             if (m_lockState.InterlockedObserveWakeSignal_Try_LockAndUnregisterWaiter(this))
@@ -450,6 +450,13 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Per-lock spin iteration limit, adapted from recent contention outcomes as a proxy
+    // for the holder's recent hold times. Halved whenever a full spin fails to acquire
+    // the lock (the hold time exceeded the spin window), recovered additively when
+    // spinning succeeds. Always within [1, g_SpinConstants.dwMonitorSpinCount].
+    // Unsynchronized; lost updates merely perturb the heuristic.
+    DWORD m_spinLimit;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
@@ -463,7 +470,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinLimit(g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -542,6 +550,39 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    DWORD GetSpinLimit() const
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoadWithoutBarrier(&m_spinLimit);
+    }
+
+    void RecordSpinSuccess()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        DWORD spinLimit = VolatileLoadWithoutBarrier(&m_spinLimit);
+        DWORD maxSpinLimit = g_SpinConstants.dwMonitorSpinCount;
+        if (spinLimit < maxSpinLimit)
+        {
+            // Recover gradually, so that one lucky spin does not restore full spinning
+            // on a lock whose holders typically outlast the spin window.
+            m_spinLimit = min(spinLimit + max(spinLimit / 4, (DWORD)1), maxSpinLimit);
+        }
+    }
+
+    void RecordSpinFailure()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        DWORD spinLimit = VolatileLoadWithoutBarrier(&m_spinLimit);
+        if (spinLimit > 1)
+        {
+            // The holder outlasted the spin window; back off quickly to stop burning
+            // CPU on spins that are unlikely to succeed.
+            m_spinLimit = max(spinLimit / 2, (DWORD)1);
+        }
+    }
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
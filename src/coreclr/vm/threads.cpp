@@ -1347,6 +1347,11 @@ void Dbg_TrackSyncStack::LeaveSync(UINT_PTR caller, void *pAwareLock)
 
 static  DWORD dwHashCodeSeed = 123456789;
 
+// One-slot cache of the most recently retired m_OSContext allocation. Workloads that
+// churn through short-lived threads allocate and free this structure on every thread
+// start and exit; recycling the block between threads avoids that heap traffic.
+static CONTEXT * volatile s_pOSContextCache = NULL;
+
 //--------------------------------------------------------------------
 // Thread construction
 //--------------------------------------------------------------------
@@ -1360,6 +1365,7 @@ Thread::Thread()
 
     m_pFrame                = FRAME_TOP;
     m_pGCFrame              = NULL;
+    m_pStackScanRootCache   = NULL;
 
     m_fPreemptiveGCDisabled = 0;
 
@@ -1497,7 +1503,15 @@ Thread::Thread()
     m_dwAbortPoint = 0;
 #endif
 
-    m_OSContext = new CONTEXT();
+    m_OSContext = InterlockedExchangeT(&s_pOSContextCache, (CONTEXT *)NULL);
+    if (m_OSContext != NULL)
+    {
+        memset(m_OSContext, 0, sizeof(CONTEXT));
+    }
+    else
+    {
+        m_OSContext = new CONTEXT();
+    }
     NewHolder<CONTEXT> contextHolder(m_OSContext);
 
     m_pSavedRedirectContext = NULL;
@@ -2521,7 +2535,13 @@ Thread::~Thread()
     }
 
     if (m_OSContext)
-        delete m_OSContext;
+    {
+        // Park the allocation for the next thread to start; delete the previously
+        // parked one, if any.
+        m_OSContext = InterlockedExchangeT(&s_pOSContextCache, m_OSContext);
+        if (m_OSContext)
+            delete m_OSContext;
+    }
 
     if (m_pOSContextBuffer)
     {
@@ -2556,6 +2576,12 @@ Thread::~Thread()
 
     m_tailCallTls.FreeArgBuffer();
 
+    if (m_pStackScanRootCache != NULL)
+    {
+        DeleteStackScanRootCache(m_pStackScanRootCache);
+        m_pStackScanRootCache = NULL;
+    }
+
 #ifdef FEATURE_EVENT_TRACE
     // Destruct the thread local type cache for allocation sampling
     if(m_pAllLoggedTypes) {
@@ -2567,6 +2593,42 @@ Thread::~Thread()
     CrstHolder lock(&g_DeadlockAwareCrst);
 }
 
+// Return the amount of CPU time the thread has consumed so far. The units differ
+// between platforms (cycles on Windows, nanoseconds on Linux), so the value is
+// only meaningful for equality comparisons - an unchanged value means the thread
+// has not executed in between the two queries.
+//
+// Limited to Windows and Linux: the cycle counter and the thread CPU clock
+// cannot report the same value across any execution of the thread. The other
+// PAL implementations are too coarse for that guarantee - the mach thread_info
+// times on macOS are truncated to microseconds and the Solaris fallback reads
+// only pr_utime - so a short execution burst can leave the reported value
+// unchanged, and an equality comparison would wrongly conclude the thread has
+// not run.
+bool Thread::GetThreadCpuTime(uint64_t* pCpuTime)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#if defined(TARGET_WINDOWS) || defined(TARGET_LINUX)
+    HANDLE hThread = GetThreadHandle();
+    if (hThread == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    ULONG64 cycles;
+    if (!QueryThreadCycleTime(hThread, &cycles))
+    {
+        return false;
+    }
+
+    *pCpuTime = cycles;
+    return true;
+#else
+    return false;
+#endif
+}
+
 #ifdef FEATURE_COMINTEROP_APARTMENT_SUPPORT
 
 void Thread::BaseCoUninitialize()
@@ -143,9 +143,14 @@ class     CRWLock;
 struct    LockEntry;
 class     PrepareCodeConfig;
 class     NativeCodeVersion;
+class     StackScanRootCache;
 
 typedef void(*ADCallBackFcnType)(LPVOID);
 
+// Destroy a Thread's memoized GC stack scan roots. Implemented in gcenv.ee.cpp
+// where the StackScanRootCache class is defined.
+void DeleteStackScanRootCache(StackScanRootCache* pCache);
+
 #include "stackwalktypes.h"
 #include "log.h"
 #include "excep.h"
@@ -1373,6 +1378,13 @@ public:
         return (m_fPreemptiveGCDisabled);
     }
 
+    // Return the amount of CPU time this thread has consumed so far. The units
+    // differ between platforms, so the value is only meaningful for equality
+    // comparisons. Returns false when the time cannot be obtained or is not
+    // precise enough for equality to prove the thread has not executed; see
+    // the definition for the platform requirements.
+    bool GetThreadCpuTime(uint64_t* pCpuTime);
+
 #ifdef ENABLE_CONTRACTS_IMPL
 
     void BeginNoTriggerGC(const char *szFile, int lineNum)
@@ -3767,6 +3779,25 @@ private:
 
     PTR_GCFrame m_pGCFrame; // The topmost GC Frame
 
+    // Memoized roots from the last GC stack scan of this thread. Allocated on
+    // demand when stack scan memoization is enabled and owned by this Thread.
+    StackScanRootCache* m_pStackScanRootCache;
+
+public:
+    StackScanRootCache* GetStackScanRootCache()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_pStackScanRootCache;
+    }
+
+    void SetStackScanRootCache(StackScanRootCache* pCache)
+    {
+        LIMITED_METHOD_CONTRACT;
+        _ASSERTE((pCache == NULL) || (m_pStackScanRootCache == NULL));
+        m_pStackScanRootCache = pCache;
+    }
+
+private:
 #ifndef TARGET_UNIX
     WORD m_wCPUGroup;
     DWORD_PTR m_pAffinityMask;
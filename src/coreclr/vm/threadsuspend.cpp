@@ -3340,23 +3340,68 @@ void ThreadSuspend::SuspendAllThreads()
     int remaining = 0;
     bool observeOnly = false;
 
+    // Threads observed in cooperative mode on the first pass are collected here, so
+    // that retry passes only revisit the stragglers instead of rescanning the whole
+    // thread list. With many threads the stragglers are typically a small minority,
+    // and this makes the per-pass cost scale with their count rather than with the
+    // thread count. The list is stable while we hold the ThreadStore lock; if the
+    // allocation fails, or if the list grows underneath us at process exit, we fall
+    // back to rescanning the full list on every pass.
+    LONG threadCount = ThreadStore::s_pThreadStore->ThreadCountInEE();
+    Thread** stragglers = new (nothrow) Thread*[threadCount];
+    bool haveStragglers = false;
+
     while(true)
     {
         prevRemaining = remaining;
         remaining = 0;
 
-        Thread* pTargetThread = NULL;
-        while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
+        if (!haveStragglers)
         {
-            if (pTargetThread == pCurThread)
-                continue;
+            Thread* pTargetThread = NULL;
+            while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
+            {
+                if (pTargetThread == pCurThread)
+                    continue;
 
-            if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
+                if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
+                {
+                    if ((stragglers != NULL) && (remaining < threadCount))
+                    {
+                        stragglers[remaining] = pTargetThread;
+                    }
+                    else if (stragglers != NULL)
+                    {
+                        // more cooperative threads than expected, do not use the array
+                        delete[] stragglers;
+                        stragglers = NULL;
+                    }
+
+                    remaining++;
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
+                }
+            }
+
+            haveStragglers = (stragglers != NULL);
+        }
+        else
+        {
+            // Compact the surviving stragglers in place; `remaining` never gets
+            // ahead of the read index, so this cannot overwrite an unvisited entry.
+            for (int i = 0; i < prevRemaining; i++)
             {
-                remaining++;
-                if (!observeOnly)
+                Thread* pTargetThread = stragglers[i];
+                if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
                 {
-                    pTargetThread->Hijack();
+                    stragglers[remaining] = pTargetThread;
+                    remaining++;
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
                 }
             }
         }
@@ -3387,6 +3432,8 @@ void ThreadSuspend::SuspendAllThreads()
         }
     }
 
+    delete[] stragglers;
+
 #if defined(TARGET_ARM) || defined(TARGET_ARM64)
     // Flush the store buffers on all CPUs, to ensure that all changes made so far are seen
     // by the GC threads. This only matters on weak memory ordered processors as
@@ -21,7 +21,9 @@ const char g_psBaseLibrary[]      = CoreLibName_IL_A;
 const char g_psBaseLibraryName[]  = CoreLibName_A;
 const char g_psBaseLibrarySatelliteAssemblyName[]  = CoreLibSatelliteName_A;
 
-volatile int32_t g_TrapReturningThreads;
+// Aligned to a cache line of its own: every GC poll site in JITed code loads this flag, so letting
+// it share a line with unrelated globals turns stores to those globals into poll-site cache misses.
+DECLSPEC_ALIGN(64) volatile int32_t g_TrapReturningThreads;
 
 #ifdef _DEBUG
 // next two variables are used to enforce an ASSERT in Thread::DbgFindThread
@@ -307,7 +307,7 @@ GARY_DECL(TypeHandle, g_pPredefinedArrayTypes, ELEMENT_TYPE_MAX);
 // Other bits are used as a counter to enable thread trapping for other reasons, such as ThreadAbort.
 // There could be several active reasons for thread trapping at a time, like aborting multiple threads,
 // thus g_TrapReturningThreads value could be > 3.
-extern "C" volatile int32_t g_TrapReturningThreads;
+extern "C" DECLSPEC_ALIGN(64) volatile int32_t g_TrapReturningThreads;
 
 #ifdef _DEBUG
 // next two variables are used to enforce an ASSERT in Thread::DbgFindThread
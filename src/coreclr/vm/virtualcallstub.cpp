@@ -3374,10 +3374,6 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
         PRECONDITION(insertKind != IK_NONE);
     } CONTRACTL_END;
 
-#ifdef CHAIN_LOOKUP
-    CrstHolder lh(&m_writeLock);
-#endif
-
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
     UINT16 hash    = HashMT(tokHash, elem->pMT);
@@ -3387,6 +3383,21 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
     BOOL   hit     = FALSE;
     BOOL   collide = FALSE;
 
+#ifdef CHAIN_LOOKUP
+    // Under startup storms many threads race to insert an element for the
+    // same tuple. Lookup is safe without the lock (the resolve stubs search
+    // these chains concurrently), so detect that case before serializing on
+    // the write lock; the lookup is repeated under the lock below to close
+    // the race with an insert that lands after this check.
+    if (Lookup(elem->token, tokHash, elem->pMT))
+    {
+        stats.insert_cache_miss++;
+        return TRUE;
+    }
+
+    CrstHolder lh(&m_writeLock);
+#endif
+
 #ifdef _DEBUG
     elem->debug_hash = tokHash;
     elem->debug_index = idx;
@@ -3490,14 +3501,23 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
         FORBID_FAULT;
     } CONTRACTL_END;
 
-    CrstHolder lh(&m_writeLock);
-    g_chained_entry_promoted++;
-
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
     UINT16 hash    = HashMT(tokHash, elem->pMT);
     UINT16 idx     = hash;
 
+    // If the element is already at the head of its chain there is nothing to
+    // promote, so skip taking the write lock. This is the common case when
+    // several threads funnel through the chain-hit slow path for the same hot
+    // site before the first promotion becomes visible to them.
+    if (GetCacheEntry(idx) == elem)
+    {
+        return;
+    }
+
+    CrstHolder lh(&m_writeLock);
+    g_chained_entry_promoted++;
+
     ResolveCacheElem *curElem = GetCacheEntry(idx);
 
     // If someone raced in and promoted this element before us,
@@ -1099,6 +1099,46 @@ test_vector_ptr_fixed_or_malloc_reset_alloc_capacity (void)
 	return OK;
 }
 
+static
+RESULT
+test_vector_ptr_small (void)
+{
+	dn_vector_ptr_small_t vector;
+
+	if (!dn_vector_ptr_small_init (&vector))
+		return FAILED ("failed small vector init");
+
+	if (dn_vector_ptr_capacity (&vector.vector) != 8)
+		return FAILED ("small vector initial capacity didn't match");
+
+	// Filling up to the inline capacity shouldn't leave the struct's storage.
+	for (uint32_t i = 0; i < 8; ++i) {
+		if (!dn_vector_ptr_push_back (&vector.vector, (char *)test_vector_ptr_items [i % ARRAY_SIZE (test_vector_ptr_items)]))
+			return FAILED ("failed small vector push_back #1");
+	}
+
+	if ((uint8_t *)vector.vector.data < (uint8_t *)&vector || (uint8_t *)vector.vector.data >= (uint8_t *)(&vector + 1))
+		return FAILED ("small vector should use inline storage");
+
+	// Growing past the inline capacity should switch to dynamic allocation.
+	for (uint32_t i = 8; i < 64; ++i) {
+		if (!dn_vector_ptr_push_back (&vector.vector, (char *)test_vector_ptr_items [i % ARRAY_SIZE (test_vector_ptr_items)]))
+			return FAILED ("failed small vector push_back #2");
+	}
+
+	if ((uint8_t *)vector.vector.data >= (uint8_t *)&vector && (uint8_t *)vector.vector.data < (uint8_t *)(&vector + 1))
+		return FAILED ("grown small vector should have switched to dynamic allocator");
+
+	for (uint32_t i = 0; i < 64; ++i) {
+		if (*dn_vector_ptr_index (&vector.vector, i) != test_vector_ptr_items [i % ARRAY_SIZE (test_vector_ptr_items)])
+			return FAILED ("small vector value didn't match");
+	}
+
+	dn_vector_ptr_small_dispose (&vector);
+
+	return OK;
+}
+
 static
 RESULT
 test_vector_ptr_teardown (void)
@@ -1145,6 +1185,7 @@ static Test dn_vector_ptr_tests [] = {
 	{"test_vector_ptr_fixed_or_malloc_alloc_capacity", test_vector_ptr_fixed_or_malloc_alloc_capacity},
 	{"test_vector_ptr_fixed_reset_alloc_capacity", test_vector_ptr_fixed_reset_alloc_capacity},
 	{"test_vector_ptr_fixed_or_malloc_reset_alloc_capacity", test_vector_ptr_fixed_or_malloc_reset_alloc_capacity},
+	{"test_vector_ptr_small", test_vector_ptr_small},
 	{"test_vector_ptr_teardown", test_vector_ptr_teardown},
 	{NULL, NULL}
 };
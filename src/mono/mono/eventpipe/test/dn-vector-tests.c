@@ -1189,6 +1189,41 @@ test_vector_big (void)
 	return OK;
 }
 
+static
+RESULT
+test_vector_local_storage (void)
+{
+	int32_t i;
+	DN_VECTOR_LOCAL_T (vector, int32_t, 8);
+
+	if (dn_vector_capacity (&vector) != 8)
+		return FAILED ("local vector initial capacity didn't match");
+
+	// Filling up to the inline capacity shouldn't touch the heap.
+	for (i = 0; i < 8; ++i)
+		if (!dn_vector_push_back (&vector, i))
+			return FAILED ("local vector push_back failed #1");
+
+	if (vector.data < __buffer_vector || vector.data >= __buffer_vector + sizeof (__buffer_vector))
+		return FAILED ("local vector should use inline storage");
+
+	// Growing past the inline capacity should switch to dynamic allocation.
+	for (i = 8; i < 100; ++i)
+		if (!dn_vector_push_back (&vector, i))
+			return FAILED ("local vector push_back failed #2");
+
+	if (vector.data >= __buffer_vector && vector.data < __buffer_vector + sizeof (__buffer_vector))
+		return FAILED ("grown local vector should have switched to dynamic allocator");
+
+	for (i = 0; i < 100; ++i)
+		if (*dn_vector_index_t (&vector, int32_t, i) != i)
+			return FAILED ("local vector value didn't match");
+
+	dn_vector_dispose (&vector);
+
+	return OK;
+}
+
 static
 RESULT
 test_vector_teardown (void)
@@ -1246,6 +1281,7 @@ static Test dn_vector_tests [] = {
 	{"test_vector_foreach_it", test_vector_foreach_it},
 	{"test_vector_foreach_rev_it", test_vector_foreach_rev_it},
 	{"test_vector_big", test_vector_big},
+	{"test_vector_local_storage", test_vector_local_storage},
 	{"test_vector_teardown", test_vector_teardown},
 	{NULL, NULL}
 };
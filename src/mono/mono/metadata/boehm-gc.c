@@ -1582,6 +1582,20 @@ mono_gchandle_free_internal (MonoGCHandle gch)
 	MONO_PROFILER_RAISE (gc_handle_deleted, (gchandle, (MonoGCHandleType)handles->type));
 }
 
+/**
+ * mono_gchandle_free_many_internal:
+ * \param gchandles an array of \p count GCHandle handles. NULL entries are skipped.
+ * \param count the number of entries in \p gchandles
+ *
+ * Frees all the handles in \p gchandles.
+ */
+void
+mono_gchandle_free_many_internal (MonoGCHandle *gchandles, int count)
+{
+	for (int i = 0; i < count; i++)
+		mono_gchandle_free_internal (gchandles [i]);
+}
+
 guint64
 mono_gc_get_total_allocated_bytes (MonoBoolean precise)
 {
@@ -1095,8 +1095,8 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 		if (mm) {
 			mono_mem_manager_lock (mm);
 			if (!mm->szarray_cache)
-				mm->szarray_cache = g_hash_table_new_full (mono_aligned_addr_hash, NULL, NULL, NULL);
-			cached = (MonoClass *)g_hash_table_lookup (mm->szarray_cache, eclass);
+				mm->szarray_cache = dn_simdhash_ptr_ptr_new (0, NULL);
+			dn_simdhash_ptr_ptr_try_get_value (mm->szarray_cache, eclass, (void **)&cached);
 			mono_mem_manager_unlock (mm);
 		} else {
 			/*
@@ -1106,8 +1106,8 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 			 */
 			mono_os_mutex_lock (&image->szarray_cache_lock);
 			if (!image->szarray_cache)
-				image->szarray_cache = g_hash_table_new (mono_aligned_addr_hash, NULL);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
+				image->szarray_cache = dn_simdhash_ptr_ptr_new (0, NULL);
+			dn_simdhash_ptr_ptr_try_get_value (image->szarray_cache, eclass, (void **)&cached);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
@@ -1241,11 +1241,11 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 	if (rank == 1 && !bounded) {
 		if (mm) {
 			mono_mem_manager_lock (mm);
-			cached = (MonoClass *)g_hash_table_lookup (mm->szarray_cache, eclass);
+			dn_simdhash_ptr_ptr_try_get_value (mm->szarray_cache, eclass, (void **)&cached);
 			mono_mem_manager_unlock (mm);
 		} else {
 			mono_os_mutex_lock (&image->szarray_cache_lock);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
+			dn_simdhash_ptr_ptr_try_get_value (image->szarray_cache, eclass, (void **)&cached);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
@@ -1284,11 +1284,11 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 	if (rank == 1 && !bounded) {
 		if (mm) {
 			mono_mem_manager_lock (mm);
-			g_hash_table_insert (mm->szarray_cache, eclass, klass);
+			dn_simdhash_ptr_ptr_try_add (mm->szarray_cache, eclass, klass);
 			mono_mem_manager_unlock (mm);
 		} else {
 			mono_os_mutex_lock (&image->szarray_cache_lock);
-			g_hash_table_insert (image->szarray_cache, eclass, klass);
+			dn_simdhash_ptr_ptr_try_add (image->szarray_cache, eclass, klass);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
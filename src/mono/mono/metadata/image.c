@@ -1419,6 +1419,10 @@ mono_image_storage_new_raw_data (char *datac, guint32 data_len, gboolean raw_dat
 	char *key = (name == NULL) ? g_strdup_printf ("data-%p", datac) : g_strdup (name);
 	MonoImageStorage *published_storage = NULL;
 	if (mono_image_storage_tryaddref (key, &published_storage)) {
+		/* An allocated copy handed to us is never published on this path; free it
+		 * so that losing the race to an already published storage does not leak it. */
+		if (raw_data_allocated)
+			g_free (datac);
 		g_free (key);
 		return published_storage;
 	}
@@ -1637,17 +1641,25 @@ mono_image_open_from_data_internal (MonoAssemblyLoadContext *alc, char *data, gu
 		return NULL;
 	}
 	datac = data;
-	if (need_copy) {
-		datac = (char *)g_try_malloc (data_len);
-		if (!datac) {
-			if (status)
-				*status = MONO_IMAGE_ERROR_ERRNO;
-			return NULL;
+	MonoImageStorage *storage = NULL;
+	if (need_copy && filename != NULL && mono_image_storage_tryaddref (filename, &storage)) {
+		/* Raw data storages are deduplicated by name. When a storage for this image
+		 * is already published, reuse its mapping instead of copying the whole image
+		 * again only for the storage cache to discard the copy. */
+		datac = storage->raw_data;
+	} else {
+		if (need_copy) {
+			datac = (char *)g_try_malloc (data_len);
+			if (!datac) {
+				if (status)
+					*status = MONO_IMAGE_ERROR_ERRNO;
+				return NULL;
+			}
+			memcpy (datac, data, data_len);
 		}
-		memcpy (datac, data, data_len);
-	}
 
-	MonoImageStorage *storage = mono_image_storage_new_raw_data (datac, data_len, need_copy, filename);
+		storage = mono_image_storage_new_raw_data (datac, data_len, need_copy, filename);
+	}
 	image = g_new0 (MonoImage, 1);
 	image->storage = storage;
 	mono_image_init_raw_data (image, storage);
@@ -2076,7 +2088,7 @@ mono_image_close_except_pools (MonoImage *image)
 		g_hash_table_destroy (image->array_cache);
 	}
 	if (image->szarray_cache)
-		g_hash_table_destroy (image->szarray_cache);
+		dn_simdhash_free (image->szarray_cache);
 	if (image->ptr_cache)
 		g_hash_table_destroy (image->ptr_cache);
 	if (image->name_cache) {
@@ -2119,6 +2131,8 @@ mono_image_close_except_pools (MonoImage *image)
 		mono_unload_interface_ids (image->interface_bitset);
 		mono_bitset_free (image->interface_bitset);
 	}
+	for (i = 0; i < MONO_TABLE_NUM; i++)
+		g_free ((gpointer)image->tables [i].decoded_rows);
 	if (image->image_info){
 		MonoCLIImageInfo *ii = image->image_info;
 
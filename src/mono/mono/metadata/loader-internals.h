@@ -179,7 +179,8 @@ struct _MonoMemoryManager {
 	MonoConcurrentHashTable *gclass_cache;
 
 	/* mirror caches of ones already on MonoImage. These ones contain generics */
-	GHashTable *szarray_cache, *array_cache, *ptr_cache;
+	dn_simdhash_ptr_ptr_t *szarray_cache;
+	GHashTable *array_cache, *ptr_cache;
 
 	MonoWrapperCaches wrapper_caches;
 
@@ -241,7 +241,7 @@ memory_manager_delete (MonoMemoryManager *memory_manager, gboolean debug_unload)
 	free_simdhash (&mm->ginst_cache);
 	free_simdhash (&mm->gmethod_cache);
 	free_simdhash (&mm->gsignature_cache);
-	free_hash (&mm->szarray_cache);
+	free_simdhash (&mm->szarray_cache);
 	free_hash (&mm->array_cache);
 	free_hash (&mm->ptr_cache);
 	free_hash (&mm->aggregate_modifiers_cache);
@@ -244,6 +244,20 @@ struct _MonoTableInfo {
 	 * 4 * 9 easily fits in a uint8
 	 */
 	guint8    column_offsets[MONO_TABLE_INFO_MAX_COLUMNS];
+
+	/*
+	 * Lazily materialized fixed-width (4 bytes per column) copy of the rows,
+	 * indexed by [row * column_count + col]. Only built for a few hot tables
+	 * after they have seen enough decodes, NULL otherwise. Mirrors the
+	 * immutable data at 'base', so it stays valid under metadata updates,
+	 * which redirect mutated rows to delta tables before the raw decoders
+	 * run. See mono_metadata_decode_row_raw ().
+	 */
+	const guint32 *decoded_rows;
+	/* Approximate number of row decodes, drives the materialization above */
+	guint32   decode_count;
+	/* Whether decoded_rows may be built for this table */
+	guint     row_cacheable : 1;
 };
 
 #define REFERENCE_MISSING ((gpointer) -1)
@@ -448,7 +462,7 @@ struct _MonoImage {
 	GHashTable *array_cache;
 	GHashTable *ptr_cache;
 
-	GHashTable *szarray_cache;
+	dn_simdhash_ptr_ptr_t *szarray_cache;
 	/* This has a separate lock to improve scalability */
 	mono_mutex_t szarray_cache_lock;
 
@@ -1036,6 +1036,12 @@ mono_metadata_compute_table_bases (MonoImage *meta)
 		table->row_size = mono_metadata_compute_size (meta, i, &table->size_bitfield);
 		mono_metadata_compute_column_offsets (table);
 		table->base = base;
+		/*
+		 * The tables which method/field/type resolution decodes over and over
+		 * again; they get a fixed-width copy of their rows once they turn out
+		 * to be hot, see mono_metadata_decode_row_raw ().
+		 */
+		table->row_cacheable = (i == MONO_TABLE_METHOD || i == MONO_TABLE_TYPEDEF || i == MONO_TABLE_MEMBERREF);
 		base += table_info_get_rows (table) * table->row_size;
 	}
 }
@@ -1298,6 +1304,42 @@ dword_align (const unsigned char *ptr)
 static void
 mono_metadata_decode_row_slow (const MonoTableInfo *t, int idx, guint32 *res, int res_size);
 
+/* Number of row decodes on a row_cacheable table before its decoded copy is built */
+#define DECODED_ROWS_THRESHOLD 128
+
+/*
+ * Materializes the fixed-width copy of the rows of \p t, decoding every row
+ * once so that subsequent decodes are plain loads. The copy is published with
+ * a CAS, so concurrent callers may build it twice but only one copy survives.
+ */
+static void
+mono_metadata_materialize_decoded_rows (MonoTableInfo *t)
+{
+	int count = mono_metadata_table_count (t->size_bitfield);
+	guint32 rows = table_info_get_rows (t);
+	guint32 *decoded = g_new (guint32, (gsize)rows * count);
+
+	for (guint32 idx = 0; idx < rows; idx++)
+		mono_metadata_decode_row_raw (t, idx, decoded + (gsize)idx * count, count);
+
+	mono_memory_write_barrier ();
+	if (mono_atomic_cas_ptr ((volatile gpointer *)&t->decoded_rows, decoded, NULL) != NULL)
+		g_free (decoded);
+}
+
+/*
+ * Counts accesses to a row_cacheable table which doesn't have its decoded
+ * copy yet. The increment is racy on purpose: the count only needs to be
+ * approximate, and at worst two threads build the copy concurrently.
+ */
+static void
+decoded_rows_note_access (const MonoTableInfo *t)
+{
+	MonoTableInfo *table = (MonoTableInfo *)t;
+	if (++table->decode_count == DECODED_ROWS_THRESHOLD)
+		mono_metadata_materialize_decoded_rows (table);
+}
+
 /**
  * mono_metadata_decode_row:
  * \param t table to extract information from.
@@ -1337,10 +1379,19 @@ mono_metadata_decode_row_raw (const MonoTableInfo *t, int idx, guint32 *res, int
 
 	g_assert (GINT_TO_UINT32(idx) < table_info_get_rows (t));
 	g_assert (idx >= 0);
-	data = t->base + idx * t->row_size;
 
 	g_assert (res_size == count);
 
+	const guint32 *decoded = t->decoded_rows;
+	if (decoded) {
+		memcpy (res, decoded + (gsize)idx * count, count * sizeof (guint32));
+		return;
+	}
+	if (t->row_cacheable)
+		decoded_rows_note_access (t);
+
+	data = t->base + idx * t->row_size;
+
 	for (i = 0; i < count; i++) {
 		int n = mono_metadata_table_size (bitfield, i);
 
@@ -1487,6 +1538,13 @@ mono_metadata_decode_row_col_raw (const MonoTableInfo *t, int idx, guint col)
 
 	g_assert (GINT_TO_UINT32(idx) < table_info_get_rows (t));
 	g_assert (col < mono_metadata_table_count (bitfield));
+
+	const guint32 *decoded = t->decoded_rows;
+	if (decoded)
+		return decoded [(gsize)idx * mono_metadata_table_count (bitfield) + col];
+	if (t->row_cacheable)
+		decoded_rows_note_access (t);
+
 	data = t->base + idx * t->row_size + t->column_offsets [col];
 	n = mono_metadata_table_size (bitfield, col);
 	switch (n) {
@@ -2094,6 +2094,8 @@ mono_gchandle_get_target_internal (MonoGCHandle gchandle);
 
 MONO_COMPONENT_API void mono_gchandle_free_internal (MonoGCHandle gchandle);
 
+void mono_gchandle_free_many_internal (MonoGCHandle *gchandles, int count);
+
 /* Reference queue support
  *
  * A reference queue is used to get notifications of when objects are collected.
@@ -2540,6 +2540,29 @@ mono_gchandle_free_internal (MonoGCHandle gchandle)
 	sgen_gchandle_free (MONO_GC_HANDLE_TO_UINT (gchandle));
 }
 
+/**
+ * mono_gchandle_free_many_internal:
+ * \param gchandles an array of \p count GCHandle handles. NULL entries are skipped.
+ * \param count the number of entries in \p gchandles
+ *
+ * Frees all the handles in \p gchandles. Cheaper than freeing the handles one
+ * by one since the handle table allocation hints are only updated once.
+ */
+void
+mono_gchandle_free_many_internal (MonoGCHandle *gchandles, int count)
+{
+	guint32 buffer [64];
+	int i = 0;
+
+	while (i < count) {
+		int n = MIN (count - i, (int)G_N_ELEMENTS (buffer));
+		for (int j = 0; j < n; j++)
+			buffer [j] = MONO_GC_HANDLE_TO_UINT (gchandles [i + j]);
+		sgen_gchandle_free_many (n, buffer);
+		i += n;
+	}
+}
+
 /**
  * mono_gchandle_get_target_internal:
  * \param gchandle a GCHandle's handle.
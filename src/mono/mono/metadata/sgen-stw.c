@@ -111,8 +111,19 @@ static TV_DECLARE (stop_world_time);
 static guint64 max_stw_pause_time = 0;
 
 static guint64 time_stop_world;
+static guint64 time_max_stop_world;
 static guint64 time_restart_world;
 
+/*
+ * Coarse histogram of the suspend handshake latency, i.e. how long it took for
+ * every thread to reach a safepoint (or be preemptively suspended in hybrid
+ * suspend).  Useful to spot stragglers that the aggregate time hides.
+ */
+static guint64 stop_world_under_100us;
+static guint64 stop_world_under_1ms;
+static guint64 stop_world_under_10ms;
+static guint64 stop_world_over_10ms;
+
 static
 void
 sgen_client_stop_world_thread_stopped_callback (THREAD_INFO_TYPE *info)
@@ -167,6 +178,17 @@ sgen_client_stop_world (int generation, gboolean serial_collection)
 	gint64 stop_world_tv_elapsed = TV_ELAPSED (stop_world_time, end_handshake);
 	SGEN_LOG (2, "stopping world (time: %d usec)", (int)stop_world_tv_elapsed / 10);
 	time_stop_world += stop_world_tv_elapsed;
+	time_max_stop_world = MAX (GINT64_TO_UINT64 (stop_world_tv_elapsed), time_max_stop_world);
+
+	/* TV_ELAPSED is in 100ns ticks */
+	if (stop_world_tv_elapsed < 100 * 10)
+		++stop_world_under_100us;
+	else if (stop_world_tv_elapsed < 1000 * 10)
+		++stop_world_under_1ms;
+	else if (stop_world_tv_elapsed < 10000 * 10)
+		++stop_world_under_10ms;
+	else
+		++stop_world_over_10ms;
 
 	sgen_memgov_collection_start (generation);
 	if (sgen_need_bridge_processing ())
@@ -241,7 +263,12 @@ void
 mono_sgen_init_stw (void)
 {
 	mono_counters_register ("World stop", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_stop_world);
+	mono_counters_register ("Max world stop", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_max_stop_world);
 	mono_counters_register ("World restart", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_restart_world);
+	mono_counters_register ("World stops under 100us", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stop_world_under_100us);
+	mono_counters_register ("World stops under 1ms", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stop_world_under_1ms);
+	mono_counters_register ("World stops under 10ms", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stop_world_under_10ms);
+	mono_counters_register ("World stops over 10ms", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stop_world_over_10ms);
 }
 
 /* Unified suspend code */
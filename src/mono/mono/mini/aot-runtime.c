@@ -211,6 +211,16 @@ static GHashTable *ji_to_amodule;
 /* Maps method addresses to MonoAotMethodFlags */
 static GHashTable *code_to_method_flags;
 
+/*
+ * Caches extra methods which could not be found in any loaded AOT image, so
+ * repeated lookups don't search the extra_method_table of every image again.
+ * The value is aot_modules_generation + 1 at the time the failing search
+ * began; entries stamped with an older generation are stale, since an AOT
+ * image loaded after that point might contain the method.
+ */
+static GHashTable *aot_method_miss_cache;
+static guint32 aot_modules_generation;
+
 /* For debugging */
 static gint32 mono_last_aot_method = -1;
 
@@ -2341,6 +2351,8 @@ load_aot_module (MonoAssemblyLoadContext *alc, MonoAssembly *assembly, gpointer
 	}
 
 	g_hash_table_insert (aot_modules, assembly, amodule);
+	/* Invalidates the entries in aot_method_miss_cache */
+	aot_modules_generation ++;
 	mono_aot_unlock ();
 
 	init_amodule_got (amodule, TRUE);
@@ -4976,6 +4988,24 @@ mono_aot_get_method (MonoMethod *method, MonoError *error)
 		if (code)
 			return code;
 
+		/*
+		 * Check whether a previous search for this method already failed in
+		 * every loaded AOT image. Stale entries, i.e. ones recorded before
+		 * the last AOT image was loaded, are ignored.
+		 */
+		/*
+		 * The generation is captured before the search starts: if an AOT image is
+		 * loaded while the search runs, the search might have missed it, so the
+		 * cache entry must be stamped stale relative to that load.
+		 */
+		mono_aot_lock ();
+		guint32 search_generation = aot_modules_generation;
+		guint32 miss_generation = aot_method_miss_cache ? GPOINTER_TO_UINT (g_hash_table_lookup (aot_method_miss_cache, method)) : 0;
+		gboolean missed = (miss_generation == search_generation + 1);
+		mono_aot_unlock ();
+		if (missed)
+			return NULL;
+
 		cache_result = TRUE;
 		if (method_index == 0xffffff)
 			method_index = find_aot_method (method, &amodule);
@@ -5135,6 +5165,11 @@ mono_aot_get_method (MonoMethod *method, MonoError *error)
 				mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_AOT, "AOT NOT FOUND: %s.", full_name);
 				g_free (full_name);
 			}
+			mono_aot_lock ();
+			if (!aot_method_miss_cache)
+				aot_method_miss_cache = g_hash_table_new (NULL, NULL);
+			g_hash_table_insert (aot_method_miss_cache, orig_method, GUINT_TO_POINTER (search_generation + 1));
+			mono_aot_unlock ();
 			return NULL;
 		}
 
@@ -327,12 +327,49 @@ interp_v128_u1_narrow (gpointer res, gpointer v1, gpointer v2)
 }
 
 // GreaterThan
+static void
+interp_v128_i1_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_i1*)res = *(v128_i1*)v1 > *(v128_i1*)v2;
+}
+
 static void
 interp_v128_u1_greater_than (gpointer res, gpointer v1, gpointer v2)
 {
 	*(v128_u1*)res = *(v128_u1*)v1 > *(v128_u1*)v2;
 }
 
+static void
+interp_v128_i2_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_i2*)res = *(v128_i2*)v1 > *(v128_i2*)v2;
+}
+
+static void
+interp_v128_u2_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_u2*)res = *(v128_u2*)v1 > *(v128_u2*)v2;
+}
+
+static void
+interp_v128_i4_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_i4*)res = *(v128_i4*)v1 > *(v128_i4*)v2;
+}
+
+static void
+interp_v128_u4_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_u4*)res = *(v128_u4*)v1 > *(v128_u4*)v2;
+}
+
+static void
+interp_v128_r4_greater_than (gpointer res, gpointer v1, gpointer v2)
+{
+	// Float comparisons produce integer masks; the bit pattern is the result
+	*(v128_i4*)res = *(v128_r4*)v1 > *(v128_r4*)v2;
+}
+
 // LessThan
 static void
 interp_v128_i1_less_than (gpointer res, gpointer v1, gpointer v2)
@@ -352,6 +389,31 @@ interp_v128_i2_less_than (gpointer res, gpointer v1, gpointer v2)
 	*(v128_i2*)res = *(v128_i2*)v1 < *(v128_i2*)v2;
 }
 
+static void
+interp_v128_u2_less_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_u2*)res = *(v128_u2*)v1 < *(v128_u2*)v2;
+}
+
+static void
+interp_v128_i4_less_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_i4*)res = *(v128_i4*)v1 < *(v128_i4*)v2;
+}
+
+static void
+interp_v128_u4_less_than (gpointer res, gpointer v1, gpointer v2)
+{
+	*(v128_u4*)res = *(v128_u4*)v1 < *(v128_u4*)v2;
+}
+
+static void
+interp_v128_r4_less_than (gpointer res, gpointer v1, gpointer v2)
+{
+	// Float comparisons produce integer masks; the bit pattern is the result
+	*(v128_i4*)res = *(v128_r4*)v1 < *(v128_r4*)v2;
+}
+
 // Equals
 static void
 interp_v128_i1_equals (gpointer res, gpointer v1, gpointer v2)
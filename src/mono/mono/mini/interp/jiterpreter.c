@@ -792,10 +792,37 @@ build_address_taken_bitset (TransformData *td, InterpBasicBlock *bb, guint32 bit
 	}
 }
 
+/*
+ * Returns TRUE if the given basic block is the start of a finally or fault handler.
+ * Those handlers are normally invoked by the interpreter via MINT_CALL_HANDLER
+ *  (endfinally will bail out of any trace containing it unless the matching
+ *  call_handler is also part of the trace), so without an entry point at the top
+ *  of the handler body a large finally would always execute in the interpreter.
+ * Catch and filter clauses are skipped because they only run when an exception
+ *  is actually thrown, which we assume is rare.
+ */
+static gboolean
+jiterp_bb_is_eh_handler_start (TransformData *td, InterpBasicBlock *bb)
+{
+	if (bb->il_offset < 0)
+		return FALSE;
+
+	for (unsigned int i = 0; i < td->header->num_clauses; i++) {
+		MonoExceptionClause *clause = &td->header->clauses [i];
+		if (clause->flags != MONO_EXCEPTION_CLAUSE_FINALLY && clause->flags != MONO_EXCEPTION_CLAUSE_FAULT)
+			continue;
+		if (clause->handler_offset == GINT_TO_UINT32 (bb->il_offset))
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
 /*
  * Insert jiterpreter entry points at the correct candidate locations:
  * The first basic block of the function,
  * Backward branch targets (if enabled),
+ * The start of finally/fault handler bodies (if enabled),
  * The next basic block after a call instruction (if enabled)
  * To determine whether it is appropriate to insert an entry point at a given candidate location
  *  we have to scan through all the instructions to estimate whether it is possible to generate
@@ -822,6 +849,7 @@ jiterp_insert_entry_points (void *_imethod, void *_td)
 	for (InterpBasicBlock *bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
 		// Enter trace at top of functions
 		gboolean is_backwards_branch = FALSE,
+			is_handler_start = FALSE,
 			is_resume_or_first = enter_at_next;
 
 		// If backwards branches target a block, enter a trace there so that
@@ -829,7 +857,12 @@ jiterp_insert_entry_points (void *_imethod, void *_td)
 		if (mono_opt_jiterpreter_backward_branch_entries_enabled && bb->backwards_branch_target)
 			is_backwards_branch = TRUE;
 
-		gboolean enabled = (is_backwards_branch || is_resume_or_first) && !table_full;
+		// Finally/fault handlers are invoked from elsewhere in the method (or by EH),
+		//  so enter a trace at the top of their bodies to keep them in jitted code
+		if (mono_opt_jiterpreter_eh_handler_entries_enabled && jiterp_bb_is_eh_handler_start (td, bb))
+			is_handler_start = TRUE;
+
+		gboolean enabled = (is_backwards_branch || is_handler_start || is_resume_or_first) && !table_full;
 		// FIXME: This scan will likely proceed forward all the way out of the current block,
 		//  which means that for large methods we will sometimes scan the same instruction
 		//  multiple times and waste some work. At present this is unavoidable because
@@ -840,10 +873,13 @@ jiterp_insert_entry_points (void *_imethod, void *_td)
 		//  enough one to be worth it
 			should_generate_trace_here(bb) &&
 		// And don't insert another trace if we inserted one too recently, unless this
-		//  is a backwards branch target
+		//  is a backwards branch target or a handler start (both of those are entered
+		//  from somewhere other than the preceding instructions, so the distance from
+		//  the previous trace does not matter)
 			(
 				(instruction_count >= mono_opt_jiterpreter_minimum_distance_between_traces) ||
-				is_backwards_branch
+				is_backwards_branch ||
+				is_handler_start
 			);
 
 		if (mono_opt_jiterpreter_call_resume_enabled && bb->contains_call_instruction)
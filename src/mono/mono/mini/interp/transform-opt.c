@@ -3490,12 +3490,22 @@ interp_super_instructions (TransformData *td)
 				gint32 imm;
 				int imm_mt;
 				int sreg_imm = ins->sregs [1];
-				if (get_sreg_imm (td, sreg_imm, &imm, &imm_mt) && imm_mt == MINT_TYPE_I2 && imm != G_MININT16) {
-					int add_op = opcode == MINT_SUB_I4 ? MINT_ADD_I4_IMM : MINT_ADD_I8_IMM;
+				if (get_sreg_imm (td, sreg_imm, &imm, &imm_mt) &&
+						((imm_mt == MINT_TYPE_I2 && imm != G_MININT16) || (imm_mt == MINT_TYPE_I4 && imm != G_MININT32))) {
+					int add_op;
+					if (imm_mt == MINT_TYPE_I2)
+						add_op = opcode == MINT_SUB_I4 ? MINT_ADD_I4_IMM : MINT_ADD_I8_IMM;
+					else
+						add_op = opcode == MINT_SUB_I4 ? MINT_ADD_I4_IMM2 : MINT_ADD_I8_IMM2;
 					InterpInst *new_inst = interp_insert_ins (td, ins, add_op);
 					new_inst->dreg = ins->dreg;
 					new_inst->sregs [0] = ins->sregs [0];
-					new_inst->data [0] = (gint16)-imm;
+					if (imm_mt == MINT_TYPE_I2) {
+						new_inst->data [0] = (gint16)-imm;
+					} else {
+						gint32 neg_imm = -imm;
+						WRITE32_INS (new_inst, 0, &neg_imm);
+					}
 					interp_clear_ins (td->var_values [sreg_imm].def);
 					interp_clear_ins (ins);
 					td->var_values [sreg_imm].ref_count--; // 0
@@ -2874,6 +2874,14 @@ interp_get_icall_sig (MonoMethodSignature *sig)
 
 /* larger than mono jit; chosen to ensure that List<T>.get_Item can be inlined */
 #define INLINE_LENGTH_LIMIT 30
+/*
+ * When tiering is enabled, inlining only happens in the optimized tier and the
+ * optimized tier only recompiles methods whose execution counters proved them
+ * hot, so a larger code growth budget is justified there. Without tiering every
+ * method compiles straight into the optimized tier and the budget would apply
+ * to cold code too, so the default limit is kept in that case.
+ */
+#define INLINE_LENGTH_LIMIT_HOT 90
 #define INLINE_DEPTH_LIMIT 10
 
 static gboolean
@@ -2925,7 +2933,8 @@ interp_method_check_inlining (TransformData *td, MonoMethod *method, MonoMethodS
 		gboolean aggressive_inlining = (method->iflags & METHOD_IMPL_ATTRIBUTE_AGGRESSIVE_INLINING);
 		if (!aggressive_inlining)
 			aggressive_inlining = has_intrinsic_attribute(method);
-		if (!aggressive_inlining)
+		if (!aggressive_inlining &&
+				(!mono_interp_tiering_enabled () || header.code_size >= INLINE_LENGTH_LIMIT_HOT))
 			return FALSE;
 	}
 
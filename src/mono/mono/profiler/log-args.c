@@ -126,6 +126,11 @@ parse_arg (const char *arg, ProfilerConfig *config)
 		if (num_frames > MAX_FRAMES)
 			num_frames = MAX_FRAMES;
 		config->num_frames = num_frames;
+	} else if (match_option (arg, "alloc-sampling-bytes", &val)) {
+		char *end;
+		int sampling_bytes = strtoul (val, &end, 10);
+		if (sampling_bytes)
+			config->alloc_sampling_bytes = sampling_bytes;
 	} else if (match_option (arg, "maxsamples", &val)) {
 		char *end;
 		int max_samples = strtoul (val, &end, 10);
@@ -325,6 +330,9 @@ usage (void)
 
 	mono_profiler_printf ("\tnodefaults           disable legacy rules for enabling extra events");
 	mono_profiler_printf ("\t[no]alloc            enable/disable recording allocation info");
+	mono_profiler_printf ("\talloc-sampling-bytes=NUM");
+	mono_profiler_printf ("\t                     record roughly one allocation event per NUM bytes allocated");
+	mono_profiler_printf ("\t                     instead of every allocation (much cheaper than alloc)");
 	mono_profiler_printf ("\t[no]legacy           enable/disable pre Mono 5.6 default profiler events");
 	mono_profiler_printf ("\tsample[-real][=FREQ] enable/disable statistical sampling of threads");
 	mono_profiler_printf ("\t                     FREQ in Hz, 100 by default");
@@ -183,6 +183,9 @@ typedef struct {
 	// Current call depth for enter/leave events.
 	int call_depth;
 
+	// Bytes allocated since the last sampled allocation event was emitted.
+	uintptr_t alloc_bytes_since_sample;
+
 	// Indicates whether this thread is currently writing to its `buffer`.
 	gboolean busy;
 
@@ -530,6 +533,7 @@ init_thread (gboolean add_to_lls)
 	thread->attached = add_to_lls;
 	thread->did_detach = FALSE;
 	thread->call_depth = 0;
+	thread->alloc_bytes_since_sample = 0;
 	thread->busy = FALSE;
 	thread->ended = FALSE;
 
@@ -1550,6 +1554,23 @@ gc_alloc (MonoProfiler *prof, MonoObject *obj)
 	len += 7;
 	len &= ~7;
 
+	/*
+	 * In sampling mode we only emit an event once the thread has allocated
+	 * the configured number of bytes since its last sampled allocation, so
+	 * the event stream statistically attributes allocation volume to call
+	 * sites at a fraction of the cost of recording every allocation.
+	 */
+	if (log_config.alloc_sampling_bytes && !ENABLED (PROFLOG_GC_ALLOCATION_EVENTS)) {
+		MonoProfilerThread *thread = get_thread ();
+
+		thread->alloc_bytes_since_sample += len;
+
+		if (thread->alloc_bytes_since_sample < GINT_TO_UINTPTR (log_config.alloc_sampling_bytes))
+			return;
+
+		thread->alloc_bytes_since_sample = 0;
+	}
+
 	if (do_bt)
 		collect_bt (&data);
 
@@ -2491,6 +2512,9 @@ cleanup_reusable_samples (void)
 		mono_thread_hazardous_try_free (sample, free_sample_hit);
 }
 
+static void
+cleanup_sample_method_cache (void);
+
 static void
 signal_helper_thread (char c)
 {
@@ -2615,6 +2639,7 @@ log_shutdown (MonoProfiler *prof)
 	mono_thread_hazardous_try_free_all ();
 
 	cleanup_reusable_samples ();
+	cleanup_sample_method_cache ();
 
 	/*
 	 * Finally, make sure that all sample hits are freed. This should cover all
@@ -3053,6 +3078,67 @@ reuse_sample_hit (gpointer p)
 	mono_lock_free_queue_enqueue (&log_profiler.sample_reuse_queue, &sample->node);
 }
 
+/*
+ * Memoizes address -> method resolutions (including failed ones) for sample
+ * frames the async stack walker could not attribute, so that repeated hits in
+ * the same code don't each pay a JIT info table lookup. Only accessed from the
+ * dumper thread. Each cached method holds a ref which is released when the
+ * cache is pruned or torn down.
+ */
+#define SAMPLE_METHOD_CACHE_MAX_SIZE 4096
+
+static GHashTable *sample_method_cache;
+
+static void
+release_sample_method_cache_entry (gpointer key, gpointer value, gpointer user_data)
+{
+	if (value)
+		dec_method_ref_count ((MonoMethod *) value);
+}
+
+static void
+cleanup_sample_method_cache (void)
+{
+	if (!sample_method_cache)
+		return;
+
+	g_hash_table_foreach (sample_method_cache, release_sample_method_cache_entry, NULL);
+	g_hash_table_destroy (sample_method_cache);
+	sample_method_cache = NULL;
+}
+
+static MonoMethod *
+resolve_sample_frame_method (void *address)
+{
+	gpointer value;
+
+	if (!sample_method_cache)
+		sample_method_cache = g_hash_table_new (NULL, NULL);
+
+	if (g_hash_table_lookup_extended (sample_method_cache, address, NULL, &value))
+		return (MonoMethod *) value;
+
+	MonoJitInfo *ji = mono_jit_info_table_find_internal (address, TRUE, FALSE);
+	MonoMethod *method = ji ? mono_jit_info_get_method (ji) : NULL;
+
+	/*
+	 * JIT code can be freed and its address range reused, so periodically
+	 * dropping the whole cache keeps the window where we would attribute a
+	 * reused address to the old method (or keep missing a method JITted into
+	 * a previously unattributed address) short.
+	 */
+	if (g_hash_table_size (sample_method_cache) >= SAMPLE_METHOD_CACHE_MAX_SIZE) {
+		g_hash_table_foreach (sample_method_cache, release_sample_method_cache_entry, NULL);
+		g_hash_table_remove_all (sample_method_cache);
+	}
+
+	if (method)
+		inc_method_ref_count (method);
+	g_hash_table_insert (sample_method_cache, address, method);
+
+	return method;
+}
+
 static gboolean
 handle_dumper_queue_entry (void)
 {
@@ -3068,10 +3154,7 @@ handle_dumper_queue_entry (void)
 				g_assert (domain && "What happened to the domain pointer?");
 				g_assert (address && "What happened to the instruction pointer?");
 
-				MonoJitInfo *ji = mono_jit_info_table_find_internal (address, TRUE, FALSE);
-
-				if (ji)
-					method = mono_jit_info_get_method (ji);
+				method = resolve_sample_frame_method (address);
 
 				if (method)
 					inc_method_ref_count (method);
@@ -3359,7 +3442,9 @@ proflog_icall_SetGCAllocationEvents (MonoBoolean value)
 		mono_profiler_set_gc_allocation_callback (log_profiler.handle, gc_alloc);
 	} else {
 		DISABLE (PROFLOG_GC_ALLOCATION_EVENTS);
-		mono_profiler_set_gc_allocation_callback (log_profiler.handle, NULL);
+		/* The callback stays installed if sampled allocation events were requested. */
+		if (!log_config.alloc_sampling_bytes)
+			mono_profiler_set_gc_allocation_callback (log_profiler.handle, NULL);
 	}
 
 	mono_coop_mutex_unlock (&log_profiler.api_mutex);
@@ -3725,7 +3810,7 @@ mono_profiler_init_log (const char *desc)
 	if (ENABLED (PROFLOG_GC_EVENTS))
 		mono_profiler_set_gc_resize_callback (handle, gc_resize);
 
-	if (ENABLED (PROFLOG_GC_ALLOCATION_EVENTS))
+	if (ENABLED (PROFLOG_GC_ALLOCATION_EVENTS) || log_config.alloc_sampling_bytes)
 		mono_profiler_set_gc_allocation_callback (handle, gc_alloc);
 
 	if (ENABLED (PROFLOG_GC_MOVE_EVENTS))
@@ -518,6 +518,11 @@ typedef struct {
 	// Maximum number of SampleHit structures. We'll drop samples if this number is not sufficient.
 	int max_allocated_sample_hits;
 
+	// If nonzero, sample allocation events at a rate of roughly one event per
+	// this many bytes allocated, instead of recording every allocation. Only
+	// used at startup.
+	int alloc_sampling_bytes;
+
 	// Sample mode. Only used at startup.
 	MonoProfilerSampleMode sampling_mode;
 
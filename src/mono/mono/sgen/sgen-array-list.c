@@ -143,7 +143,8 @@ retry:
 		sgen_array_list_grow (array, capacity);
 		goto retry;
 	}
-	array->slot_hint = index;
+	/* The claimed slot is occupied now, start the next search right after it */
+	array->slot_hint = index + 1;
 
 	if (increase_size_before_set) {
 		sgen_array_list_update_next_slot (array, index);
@@ -166,6 +167,23 @@ retry:
 	return index;
 }
 
+/*
+ * Hints that `index` was just unset, so that subsequent allocations probe it
+ * before linearly scanning the rest of the array. The hint is only ever
+ * lowered here; allocations move it back up. Racing updates can lose, which
+ * at worst costs a longer scan on a later allocation.
+ */
+void
+sgen_array_list_hint_unset_slot (SgenArrayList *array, guint32 index)
+{
+	guint32 slot_hint;
+	do {
+		slot_hint = array->slot_hint;
+		if (index >= slot_hint)
+			return;
+	} while (mono_atomic_cas_i32 ((volatile gint32 *)&array->slot_hint, (gint32)index, (gint32)slot_hint) != (gint32)slot_hint);
+}
+
 /*
  * Does a linear search through the pointer array to find `ptr`.  Returns the index if
  * found, otherwise (guint32)-1.
@@ -144,6 +144,7 @@ sgen_array_list_get_slot (SgenArrayList *array, guint32 index)
 guint32 sgen_array_list_alloc_block (SgenArrayList *array, guint32 slots_to_add);
 guint32 sgen_array_list_add (SgenArrayList *array, gpointer ptr, int data, gboolean increase_size_before_set);
 guint32 sgen_array_list_find (SgenArrayList *array, gpointer ptr);
+void sgen_array_list_hint_unset_slot (SgenArrayList *array, guint32 index);
 gboolean sgen_array_list_default_cas_setter (volatile gpointer *slot, gpointer ptr, int data);
 gboolean sgen_array_list_default_is_slot_set (volatile gpointer *slot);
 void sgen_array_list_remove_nulls (SgenArrayList *array);
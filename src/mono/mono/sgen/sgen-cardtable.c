@@ -569,6 +569,12 @@ sgen_find_next_card (guint8 *card_data, guint8 *end)
 
 	cards = (mword*)card_data;
 	cards_end = (mword*)((mword)end & ~MWORD_MASK);
+
+#ifdef SGEN_CARD_SCAN_CHUNK_SIZE
+	while ((guint8*)cards + SGEN_CARD_SCAN_CHUNK_SIZE <= (guint8*)cards_end && sgen_card_table_chunk_is_clean ((guint8*)cards))
+		cards = (mword*)((guint8*)cards + SGEN_CARD_SCAN_CHUNK_SIZE);
+#endif
+
 	while (cards < cards_end) {
 		card = *cards;
 		if (card)
@@ -255,4 +255,12 @@ typedef target_mword SgenDescriptor;
  */
 #define SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE (1 << 24)
 
+/*
+ * Amount of promoted data each parallel minor worker is expected to handle.
+ * The number of active workers is scaled with the live data promoted by the
+ * previous nursery collection; waking more workers than the live set can feed
+ * only adds contention on the gray queue.
+ */
+#define SGEN_PARALLEL_MINOR_PROMOTED_SIZE_PER_WORKER (1 << 19)
+
 #endif
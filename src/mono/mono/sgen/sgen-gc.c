@@ -1778,6 +1778,13 @@ enqueue_scan_from_roots_jobs (SgenGrayQueue *gc_thread_gray_queue, char *heap_st
 	sgen_workers_enqueue_deferred_job (sgen_current_collection_generation, &sfej->scan_job.job, is_parallel);
 }
 
+/*
+ * Amount of data promoted by the previous nursery collection, used to scale
+ * the number of parallel minor workers. Starts out as the maximum possible
+ * value so the first collection, which has no estimate, uses all workers.
+ */
+static mword last_minor_promoted_size = (mword)-1;
+
 /*
  * Perform a nursery collection.
  *
@@ -1787,6 +1794,7 @@ static gboolean
 collect_nursery (const char *reason, gboolean is_overflow)
 {
 	gboolean needs_major, is_parallel = FALSE;
+	mword promoted_size_start = sgen_total_promoted_size;
 	mword fragment_total;
 	SgenGrayQueue gc_thread_gray_queue;
 	SgenObjectOperations *object_ops_nopar, *object_ops_par = NULL;
@@ -1817,6 +1825,24 @@ collect_nursery (const char *reason, gboolean is_overflow)
 		is_parallel = TRUE;
 	}
 
+	if (is_parallel) {
+		/*
+		 * Scale the number of active workers with the live data promoted by
+		 * the previous nursery collection. Waking up more workers than the
+		 * live set can feed leaves the extra ones contending on the gray
+		 * queue trying to steal work; a full complement only pays off for
+		 * survivor-heavy workloads. This must happen before the remset scan
+		 * jobs are enqueued since the job split count depends on it.
+		 */
+		int max_workers = sgen_workers_get_worker_count (GENERATION_NURSERY);
+		int num_workers;
+		if (last_minor_promoted_size >= (mword)max_workers * SGEN_PARALLEL_MINOR_PROMOTED_SIZE_PER_WORKER)
+			num_workers = max_workers;
+		else
+			num_workers = MAX ((int)(last_minor_promoted_size / SGEN_PARALLEL_MINOR_PROMOTED_SIZE_PER_WORKER), 1);
+		sgen_workers_set_num_active_workers (GENERATION_NURSERY, num_workers);
+	}
+
 	if (do_verify_nursery || do_dump_nursery_content)
 		sgen_debug_verify_nursery (do_dump_nursery_content);
 
@@ -2010,6 +2036,8 @@ collect_nursery (const char *reason, gboolean is_overflow)
 
 	sgen_memgov_minor_collection_end (reason, is_overflow);
 
+	last_minor_promoted_size = sgen_total_promoted_size - promoted_size_start;
+
 	/*objects are late pinned because of lack of memory, so a major is a good call*/
 	needs_major = objects_pinned > 0;
 	sgen_current_collection_generation = -1;
@@ -1089,6 +1089,7 @@ void sgen_gc_handles_report_roots (SgenUserReportRootFunc mark_func, void *gc_da
 gpointer sgen_gchandle_get_metadata (guint32 gchandle);
 GCObject *sgen_gchandle_get_target (guint32 gchandle);
 void sgen_gchandle_free (guint32 gchandle);
+void sgen_gchandle_free_many (guint32 count, const guint32 *gchandles);
 
 /* Other globals */
 
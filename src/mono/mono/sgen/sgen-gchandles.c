@@ -373,6 +373,28 @@ sgen_gchandle_get_metadata (guint32 gchandle)
 	return mono_gchandle_slot_metadata (slot, MONO_GC_HANDLE_TYPE_IS_WEAK (type));
 }
 
+/* Clears the slot of the handle. Returns TRUE if the slot was actually occupied. */
+static gboolean
+free_handle_slot (HandleData *handles, guint32 index)
+{
+	volatile gpointer *slot;
+	gpointer entry;
+
+	if (index >= handles->entries_array.capacity)
+		return FALSE;
+
+	slot = sgen_array_list_get_slot (&handles->entries_array, index);
+	entry = *slot;
+
+	if (!MONO_GC_HANDLE_OCCUPIED (entry))
+		return FALSE;
+
+	*slot = NULL;
+	protocol_gchandle_update (handles->type, (gpointer)slot, entry, NULL);
+	HEAVY_STAT (mono_atomic_dec_i32 ((volatile gint32 *)&stat_gc_handles_allocated));
+	return TRUE;
+}
+
 void
 sgen_gchandle_free (guint32 gchandle)
 {
@@ -382,24 +404,56 @@ sgen_gchandle_free (guint32 gchandle)
 	guint32 index = MONO_GC_HANDLE_SLOT (gchandle);
 	GCHandleType type = MONO_GC_HANDLE_TYPE (gchandle);
 	HandleData *handles = gc_handles_for_type (type);
-	volatile gpointer *slot;
-	gpointer entry;
 	if (!handles)
 		return;
 
-	slot = sgen_array_list_get_slot (&handles->entries_array, index);
-	entry = *slot;
-
-	if (index < handles->entries_array.capacity && MONO_GC_HANDLE_OCCUPIED (entry)) {
-		*slot = NULL;
-		protocol_gchandle_update (handles->type, (gpointer)slot, entry, NULL);
-		HEAVY_STAT (mono_atomic_dec_i32 ((volatile gint32 *)&stat_gc_handles_allocated));
+	if (free_handle_slot (handles, index)) {
+		/* Point allocations at the newly freed slot */
+		sgen_array_list_hint_unset_slot (&handles->entries_array, index);
 	} else {
 		/* print a warning? */
 	}
 	sgen_client_gchandle_destroyed ((GCHandleType)handles->type, gchandle);
 }
 
+/*
+ * Frees a batch of handles in a single pass. Equivalent to calling
+ * sgen_gchandle_free on each handle, except that the allocation hint for each
+ * handle type is only published once, after all the slots have been cleared.
+ * NULL handles are skipped, so callers can hand over sparse arrays.
+ */
+void
+sgen_gchandle_free_many (guint32 count, const guint32 *gchandles)
+{
+	/* The lowest slot index freed for each handle type, or -1 if none was */
+	guint32 min_index [HANDLE_TYPE_MAX];
+	guint32 i;
+
+	for (i = 0; i < HANDLE_TYPE_MAX; i++)
+		min_index [i] = (guint32)-1;
+
+	for (i = 0; i < count; i++) {
+		guint32 gchandle = gchandles [i];
+		if (!gchandle)
+			continue;
+
+		guint32 index = MONO_GC_HANDLE_SLOT (gchandle);
+		GCHandleType type = MONO_GC_HANDLE_TYPE (gchandle);
+		HandleData *handles = gc_handles_for_type (type);
+		if (!handles)
+			continue;
+
+		if (free_handle_slot (handles, index) && index < min_index [type])
+			min_index [type] = index;
+		sgen_client_gchandle_destroyed ((GCHandleType)handles->type, gchandle);
+	}
+
+	for (i = 0; i < HANDLE_TYPE_MAX; i++) {
+		if (min_index [i] != (guint32)-1)
+			sgen_array_list_hint_unset_slot (&gc_handles [i].entries_array, min_index [i]);
+	}
+}
+
 /*
  * Returns whether to remove the link from its hash.
  */
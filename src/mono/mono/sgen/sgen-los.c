@@ -129,6 +129,12 @@ static LOSSection *los_sections = NULL;
 static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larger sizes */
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
+/*
+ * Number of sections that are entirely free. We keep one of them around as
+ * allocation slack and return the rest to the OS as soon as they empty out,
+ * instead of holding on to them until the next sweep.
+ */
+static int los_num_empty_sections = 0;
 
 //#define USE_MALLOC
 //#define LOS_CONSISTENCY_CHECK
@@ -215,23 +221,32 @@ static LOSFreeChunks*
 get_from_size_list (LOSFreeChunks **list, size_t size)
 {
 	LOSFreeChunks *free_chunks = NULL;
+	LOSFreeChunks **best = NULL;
 	LOSSection *section;
 	size_t i, num_chunks, start_index;
 
 
 	g_assert ((size & (LOS_CHUNK_SIZE - 1)) == 0);
 
-	while (*list) {
-		free_chunks = *list;
-		if (free_chunks->size >= size)
+	/*
+	 * Pick the best fit. The exact-size lists only hold chunks of one size, so
+	 * this terminates on their first entry; only the list for larger sizes is
+	 * actually searched, which keeps splinters from chopping up big chunks.
+	 */
+	for (; *list; list = &(*list)->next_size) {
+		if ((*list)->size == size) {
+			best = list;
 			break;
-		list = &(*list)->next_size;
+		}
+		if ((*list)->size > size && (!best || (*list)->size < (*best)->size))
+			best = list;
 	}
 
-	if (!*list)
+	if (!best)
 		return NULL;
 
-	*list = free_chunks->next_size;
+	free_chunks = *best;
+	*best = free_chunks->next_size;
 
 	if (free_chunks->size > size)
 		add_free_chunk ((LOSFreeChunks*)((char*)free_chunks + size), free_chunks->size - size);
@@ -246,6 +261,8 @@ get_from_size_list (LOSFreeChunks **list, size_t size)
 		section->free_chunk_map [i] = 0;
 	}
 
+	if (section->num_free_chunks == LOS_SECTION_NUM_CHUNKS)
+		--los_num_empty_sections;
 	section->num_free_chunks -= size >> LOS_CHUNK_BITS;
 	g_assert (section->num_free_chunks >= 0);
 
@@ -336,10 +353,51 @@ get_los_section_memory (size_t size)
 
 	sgen_los_memory_usage_total += LOS_SECTION_SIZE;
 	++los_num_sections;
+	++los_num_empty_sections;
 
 	goto retry;
 }
 
+/*
+ * Unlinks all the free chunks belonging to \p section from the fast free
+ * lists. Required before a section can be released outside of sweep.
+ */
+static void
+remove_free_chunks_for_section (LOSSection *section)
+{
+	int i;
+
+	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i) {
+		LOSFreeChunks **prev = &los_fast_free_lists [i];
+		while (*prev) {
+			if (LOS_SECTION_FOR_OBJ (*prev) == section)
+				*prev = (*prev)->next_size;
+			else
+				prev = &(*prev)->next_size;
+		}
+	}
+}
+
+static void
+release_empty_section (LOSSection *section)
+{
+	LOSSection **prev_ptr = &los_sections;
+
+	g_assert (section->num_free_chunks == LOS_SECTION_NUM_CHUNKS);
+
+	while (*prev_ptr != section)
+		prev_ptr = &(*prev_ptr)->next;
+	*prev_ptr = section->next;
+
+	remove_free_chunks_for_section (section);
+
+	sgen_free_os_memory (section, LOS_SECTION_SIZE, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+	sgen_memgov_release_space (LOS_SECTION_SIZE, SPACE_LOS);
+	--los_num_sections;
+	--los_num_empty_sections;
+	sgen_los_memory_usage_total -= LOS_SECTION_SIZE;
+}
+
 static void
 free_los_section_memory (LOSObject *obj, size_t size)
 {
@@ -356,12 +414,6 @@ free_los_section_memory (LOSObject *obj, size_t size)
 	section->num_free_chunks += num_chunks;
 	g_assert (section->num_free_chunks <= LOS_SECTION_NUM_CHUNKS);
 
-	/*
-	 * We could free the LOS section here if it's empty, but we
-	 * can't unless we also remove its free chunks from the fast
-	 * free lists.  Instead, we do it in los_sweep().
-	 */
-
 	start_index = LOS_CHUNK_INDEX (obj, section);
 	for (i = start_index; i < start_index + num_chunks; ++i) {
 		g_assert (!section->free_chunk_map [i]);
@@ -369,6 +421,18 @@ free_los_section_memory (LOSObject *obj, size_t size)
 	}
 
 	add_free_chunk ((LOSFreeChunks*)SGEN_ALIGN_DOWN_TO ((mword)obj, LOS_CHUNK_SIZE), size);
+
+	/*
+	 * Return sections to the OS as soon as they empty out, so committed LOS
+	 * memory tracks the live objects instead of accumulating until the next
+	 * sweep. One empty section is kept around as slack for the next
+	 * allocation burst.
+	 */
+	if (section->num_free_chunks == LOS_SECTION_NUM_CHUNKS) {
+		++los_num_empty_sections;
+		if (los_num_empty_sections > 1)
+			release_empty_section (section);
+	}
 }
 
 void
@@ -562,6 +626,9 @@ sgen_los_sweep (void)
 		++num_sections;
 	}
 
+	/* All empty sections, including the slack one, are gone now */
+	los_num_empty_sections = 0;
+
 #ifdef LOS_CONSISTENCY_CHECK
 	los_consistency_check ();
 #endif
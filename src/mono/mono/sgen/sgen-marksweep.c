@@ -2478,7 +2478,14 @@ initial_skip_card (guint8 *card_data)
 	mword *cards = (mword*)card_data;
 	mword card = 0;
 	int i;
-	for (i = 0; i < CARD_WORDS_PER_BLOCK; ++i) {
+	int first_word = 0;
+
+#ifdef SGEN_CARD_SCAN_CHUNK_SIZE
+	while (first_word < CARD_WORDS_PER_BLOCK && sgen_card_table_chunk_is_clean (card_data + first_word * SIZEOF_VOID_P))
+		first_word += SGEN_CARD_SCAN_CHUNK_SIZE / SIZEOF_VOID_P;
+#endif
+
+	for (i = first_word; i < CARD_WORDS_PER_BLOCK; ++i) {
 		card = cards [i];
 		if (card)
 			break;
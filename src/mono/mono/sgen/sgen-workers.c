@@ -626,6 +626,12 @@ sgen_workers_get_active_worker_count (int generation)
 	return (worker_contexts [generation].active_workers_num);
 }
 
+int
+sgen_workers_get_worker_count (int generation)
+{
+	return (worker_contexts [generation].workers_num);
+}
+
 void
 sgen_workers_foreach (int generation, SgenWorkerCallback callback)
 {
@@ -695,6 +701,12 @@ sgen_workers_get_active_worker_count (int generation)
 	return 0;
 }
 
+int
+sgen_workers_get_worker_count (int generation)
+{
+	return 0;
+}
+
 gboolean
 sgen_workers_have_idle_work (int generation)
 {
@@ -309,6 +309,12 @@ mono_valloc (void *addr, size_t length, int flags, MonoMemAccountType type)
 	if (ptr == MAP_FAILED)
 		return NULL;
 
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	/* Only a hint: the kernel backs the range with huge pages when it can */
+	if (flags & MONO_MMAP_HUGEPAGE)
+		madvise (ptr, length, MADV_HUGEPAGE);
+#endif
+
 	mono_account_mem (type, (ssize_t)length);
 
 	return ptr;
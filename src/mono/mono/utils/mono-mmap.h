@@ -25,6 +25,8 @@ enum {
 	MONO_MMAP_JIT     = 1 << 9,
 	/* do not zero the new pages */
 	MONO_MMAP_NOZERO  = 1 << 10,
+	/* hint the kernel to back the mapping with (transparent) huge pages */
+	MONO_MMAP_HUGEPAGE = 1 << 11,
 };
 
 typedef enum {
@@ -107,6 +107,9 @@ DEFINE_BOOL(jiterpreter_backward_branch_entries_enabled, "jiterpreter-backward-b
 // if enabled, after a call instruction terminates a trace, we will attempt to start a new
 //  one at the next basic block. this allows jitting loop bodies that start with 'if (x) continue' etc
 DEFINE_BOOL(jiterpreter_call_resume_enabled, "jiterpreter-call-resume-enabled", TRUE, "Insert trace entry points after function calls")
+// if enabled, we will insert trace entry points at the start of finally/fault handler bodies,
+//  so that handlers invoked by the interpreter (outside of any trace) can run as jitted code
+DEFINE_BOOL(jiterpreter_eh_handler_entries_enabled, "jiterpreter-eh-handler-entries-enabled", TRUE, "Insert trace entry points at the start of finally and fault handlers")
 // For locations where the jiterpreter heuristic says we will be unable to generate
 //  a trace, insert an entry point opcode anyway. This enables collecting accurate
 //  stats for options like estimateHeat, but raises overhead.
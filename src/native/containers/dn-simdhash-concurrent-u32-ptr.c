@@ -0,0 +1,305 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef NO_CONFIG_H
+#include <dn-config.h>
+#endif
+#include "dn-simdhash.h"
+
+#include "dn-simdhash-utils.h"
+#include "dn-simdhash-concurrent-u32-ptr.h"
+
+// Concurrency strategy:
+// Readers never lock. A lookup snapshots the table pointer and the sequence
+//  counter, runs the ordinary single-threaded search, and retries if the
+//  counter changed (a writer was active) or was odd (a writer is active).
+// Writers are serialized by a mutex and bump the sequence counter to odd
+//  before mutating and back to even afterwards.
+// For this to be safe without read locks, a racing reader must never be able
+//  to dereference freed memory or a torn pointer/length pair:
+//  - The table a reader snapshots is never grown or rehashed in place. When a
+//    writer needs more space it builds a fully-populated replacement table,
+//    publishes it with a single release store, and retires the old table on a
+//    list that is only freed by _free. In-place writes (adds into existing
+//    buckets, removes, clears) never change the buffer pointers or lengths,
+//    so the worst a racing reader can observe is torn bucket *contents*,
+//    which stay in bounds and are discarded when the sequence check fails.
+//  - Because each retired table is roughly half the size of its replacement,
+//    the memory pinned this way is bounded by about the live table's size.
+
+#if defined(_MSC_VER)
+
+#include <windows.h>
+
+typedef SRWLOCK writer_lock_t;
+#define writer_lock_init(lock) InitializeSRWLock(lock)
+// SRW locks do not need to be destroyed
+#define writer_lock_destroy(lock)
+#define writer_lock_acquire(lock) AcquireSRWLockExclusive(lock)
+#define writer_lock_release(lock) ReleaseSRWLockExclusive(lock)
+
+static DN_FORCEINLINE(uint32_t)
+load_sequence_acquire (volatile uint32_t *sequence)
+{
+	return (uint32_t)ReadULongAcquire((volatile ULONG *)sequence);
+}
+
+static DN_FORCEINLINE(void)
+bump_sequence (volatile uint32_t *sequence)
+{
+	InterlockedIncrement((volatile LONG *)sequence);
+}
+
+static DN_FORCEINLINE(void *)
+load_pointer_acquire (void * volatile *pointer)
+{
+	return ReadPointerAcquire(pointer);
+}
+
+static DN_FORCEINLINE(void)
+store_pointer_release (void * volatile *pointer, void *value)
+{
+	WritePointerRelease(pointer, value);
+}
+
+static DN_FORCEINLINE(void)
+read_fence (void)
+{
+	MemoryBarrier();
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_mutex_t writer_lock_t;
+#define writer_lock_init(lock) pthread_mutex_init(lock, NULL)
+#define writer_lock_destroy(lock) pthread_mutex_destroy(lock)
+#define writer_lock_acquire(lock) pthread_mutex_lock(lock)
+#define writer_lock_release(lock) pthread_mutex_unlock(lock)
+
+static DN_FORCEINLINE(uint32_t)
+load_sequence_acquire (volatile uint32_t *sequence)
+{
+	return __atomic_load_n(sequence, __ATOMIC_ACQUIRE);
+}
+
+static DN_FORCEINLINE(void)
+bump_sequence (volatile uint32_t *sequence)
+{
+	__atomic_fetch_add(sequence, 1, __ATOMIC_ACQ_REL);
+}
+
+static DN_FORCEINLINE(void *)
+load_pointer_acquire (void * volatile *pointer)
+{
+	return __atomic_load_n(pointer, __ATOMIC_ACQUIRE);
+}
+
+static DN_FORCEINLINE(void)
+store_pointer_release (void * volatile *pointer, void *value)
+{
+	__atomic_store_n(pointer, value, __ATOMIC_RELEASE);
+}
+
+static DN_FORCEINLINE(void)
+read_fence (void)
+{
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+
+#endif // _MSC_VER
+
+// The underlying single-threaded table. Instantiating our own specialization
+//  (instead of reusing dn_simdhash_u32_ptr) gives this translation unit access
+//  to try_insert_internal, so the grow path can be intercepted and replaced
+//  with table replacement.
+#define DN_SIMDHASH_T dn_simdhash_concurrent_u32_ptr_table
+#define DN_SIMDHASH_KEY_T uint32_t
+#define DN_SIMDHASH_VALUE_T void *
+#define DN_SIMDHASH_KEY_HASHER(hash, key) murmur3_fmix32(key)
+#define DN_SIMDHASH_KEY_EQUALS(hash, lhs, rhs) (lhs == rhs)
+
+#include "dn-simdhash-specialization.h"
+
+typedef struct retired_table_t {
+	struct retired_table_t *next;
+	dn_simdhash_t *table;
+} retired_table_t;
+
+struct dn_simdhash_concurrent_u32_ptr_t {
+	// The current table. Readers follow this through an acquire load; it only
+	//  ever points at a fully-populated table.
+	dn_simdhash_t * volatile table;
+	// Odd while a writer is mutating the current table.
+	volatile uint32_t sequence;
+	writer_lock_t writer_lock;
+	dn_allocator_t *allocator;
+	// Tables replaced by a grow, kept alive for racing readers until _free.
+	retired_table_t *retired_tables;
+};
+
+dn_simdhash_concurrent_u32_ptr_t *
+dn_simdhash_concurrent_u32_ptr_new (uint32_t capacity, dn_allocator_t *allocator)
+{
+	dn_simdhash_concurrent_u32_ptr_t *result = dn_allocator_alloc(allocator, sizeof(dn_simdhash_concurrent_u32_ptr_t));
+	memset(result, 0, sizeof(dn_simdhash_concurrent_u32_ptr_t));
+	result->allocator = allocator;
+	result->table = dn_simdhash_concurrent_u32_ptr_table_new(capacity, allocator);
+	writer_lock_init(&result->writer_lock);
+	return result;
+}
+
+// The caller is responsible for ensuring no other thread is still using the
+//  table when it is freed; readers racing with _free cannot be protected.
+void
+dn_simdhash_concurrent_u32_ptr_free (dn_simdhash_concurrent_u32_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	dn_simdhash_free(hash->table);
+	retired_table_t *retired = hash->retired_tables;
+	while (retired) {
+		retired_table_t *next = retired->next;
+		dn_simdhash_free(retired->table);
+		dn_allocator_free(hash->allocator, retired);
+		retired = next;
+	}
+	writer_lock_destroy(&hash->writer_lock);
+	dn_allocator_free(hash->allocator, hash);
+}
+
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_get_value (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key, void **result)
+{
+	dn_simdhash_assert(hash);
+	uint32_t key_hash = murmur3_fmix32(key);
+	for (;;) {
+		uint32_t sequence = load_sequence_acquire(&hash->sequence);
+		if (sequence & 1)
+			// A writer is active right now; spin until it's done.
+			continue;
+		dn_simdhash_t *table = load_pointer_acquire((void * volatile *)&hash->table);
+		void *value = NULL;
+		uint8_t found = dn_simdhash_concurrent_u32_ptr_table_try_get_value_with_hash(table, key, key_hash, &value);
+		// Make sure the search's loads complete before we re-check the sequence,
+		//  then discard anything we read if a writer was active in the interim.
+		read_fence();
+		if (load_sequence_acquire(&hash->sequence) == sequence) {
+			if (found && result)
+				*result = value;
+			return found;
+		}
+	}
+}
+
+static void
+copy_item_to_new_table (uint32_t key, void *value, void *_new_table)
+{
+	dn_simdhash_t *new_table = (dn_simdhash_t *)_new_table;
+	dn_simdhash_assert(dn_simdhash_concurrent_u32_ptr_table_try_add(new_table, key, value));
+}
+
+// Builds a double-sized replacement for the current table, publishes it, and
+//  retires the old one. Called with the writer lock held, outside the sequence
+//  counter - the old table isn't mutated, so concurrent readers are fine with
+//  either table.
+static void
+grow_and_publish_replacement (dn_simdhash_concurrent_u32_ptr_t *hash)
+{
+	dn_simdhash_t *table = hash->table;
+	dn_simdhash_t *new_table = dn_simdhash_concurrent_u32_ptr_table_new(dn_simdhash_capacity(table) + 1, hash->allocator);
+	dn_simdhash_concurrent_u32_ptr_table_foreach(table, copy_item_to_new_table, new_table);
+	// A published table must never have a migration pending: completing one
+	//  frees the retired buffers, which a racing reader could be probing.
+	//  Populating a correctly-sized empty table shouldn't start one, but drain
+	//  defensively while the new table is still private.
+	while (dn_simdhash_migration_in_progress(new_table))
+		migrate_pending_buckets(new_table);
+
+	retired_table_t *retired = dn_allocator_alloc(hash->allocator, sizeof(retired_table_t));
+	retired->table = table;
+	retired->next = hash->retired_tables;
+	hash->retired_tables = retired;
+
+	store_pointer_release((void * volatile *)&hash->table, new_table);
+}
+
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_add (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key, void *value)
+{
+	dn_simdhash_assert(hash);
+	uint32_t key_hash = murmur3_fmix32(key);
+	writer_lock_acquire(&hash->writer_lock);
+
+	bump_sequence(&hash->sequence);
+	dn_simdhash_insert_result ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(hash->table, key, key_hash, value, DN_SIMDHASH_INSERT_MODE_ENSURE_UNIQUE);
+	if (ok == DN_SIMDHASH_INSERT_NEED_TO_GROW) {
+		// A failed insert didn't mutate anything, so let readers run while we
+		//  build the replacement table.
+		bump_sequence(&hash->sequence);
+		grow_and_publish_replacement(hash);
+		bump_sequence(&hash->sequence);
+		ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(hash->table, key, key_hash, value, DN_SIMDHASH_INSERT_MODE_ENSURE_UNIQUE);
+	}
+	if (ok == DN_SIMDHASH_INSERT_OK_ADDED_NEW)
+		hash->table->count++;
+	bump_sequence(&hash->sequence);
+
+	writer_lock_release(&hash->writer_lock);
+
+	switch (ok) {
+		case DN_SIMDHASH_INSERT_OK_ADDED_NEW:
+			return 1;
+		case DN_SIMDHASH_INSERT_KEY_ALREADY_PRESENT:
+			return 0;
+		default:
+			dn_simdhash_assert(!"Failed to add a new item but there was no existing item");
+			return 0;
+	}
+}
+
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_remove (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key)
+{
+	dn_simdhash_assert(hash);
+	uint32_t key_hash = murmur3_fmix32(key);
+	writer_lock_acquire(&hash->writer_lock);
+	bump_sequence(&hash->sequence);
+	uint8_t result = dn_simdhash_concurrent_u32_ptr_table_try_remove_with_hash(hash->table, key, key_hash);
+	bump_sequence(&hash->sequence);
+	writer_lock_release(&hash->writer_lock);
+	return result;
+}
+
+void
+dn_simdhash_concurrent_u32_ptr_clear (dn_simdhash_concurrent_u32_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	writer_lock_acquire(&hash->writer_lock);
+	bump_sequence(&hash->sequence);
+	dn_simdhash_clear(hash->table);
+	bump_sequence(&hash->sequence);
+	writer_lock_release(&hash->writer_lock);
+}
+
+// Under concurrent writes the result is naturally approximate by the time the
+//  caller looks at it.
+uint32_t
+dn_simdhash_concurrent_u32_ptr_count (dn_simdhash_concurrent_u32_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	dn_simdhash_t *table = load_pointer_acquire((void * volatile *)&hash->table);
+	return dn_simdhash_count(table);
+}
+
+void
+dn_simdhash_concurrent_u32_ptr_foreach (dn_simdhash_concurrent_u32_ptr_t *hash, dn_simdhash_concurrent_u32_ptr_foreach_func func, void *user_data)
+{
+	dn_simdhash_assert(hash);
+	dn_simdhash_assert(func);
+	// Iteration doesn't mutate, so concurrent readers are unaffected and only
+	//  writers need to be held off; no sequence bump.
+	writer_lock_acquire(&hash->writer_lock);
+	dn_simdhash_concurrent_u32_ptr_table_foreach(hash->table, (dn_simdhash_concurrent_u32_ptr_table_foreach_func)func, user_data);
+	writer_lock_release(&hash->writer_lock);
+}
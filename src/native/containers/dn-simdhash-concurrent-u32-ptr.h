@@ -0,0 +1,57 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __DN_SIMDHASH_CONCURRENT_U32_PTR_H__
+#define __DN_SIMDHASH_CONCURRENT_U32_PTR_H__
+
+#include "dn-simdhash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A multi-reader wrapper around dn_simdhash_u32_ptr for read-dominated tables.
+// Readers never take a lock: lookups run under a sequence counter and retry if
+//  a writer was active, so any number of readers scale without contention.
+// Writers (add/remove/clear) are serialized internally by a mutex.
+// To keep lock-free readers safe against concurrent grows, bucket arrays
+//  retired by a resize are kept alive until the table is freed instead of
+//  being released immediately. Because each retired generation is half the
+//  size of the next, the total retained memory is bounded by roughly the
+//  size of the live table.
+typedef struct dn_simdhash_concurrent_u32_ptr_t dn_simdhash_concurrent_u32_ptr_t;
+
+dn_simdhash_concurrent_u32_ptr_t *
+dn_simdhash_concurrent_u32_ptr_new (uint32_t capacity, dn_allocator_t *allocator);
+
+void
+dn_simdhash_concurrent_u32_ptr_free (dn_simdhash_concurrent_u32_ptr_t *hash);
+
+// Safe to call from any number of threads concurrently with writers.
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_get_value (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key, void **result);
+
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_add (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key, void *value);
+
+uint8_t
+dn_simdhash_concurrent_u32_ptr_try_remove (dn_simdhash_concurrent_u32_ptr_t *hash, uint32_t key);
+
+void
+dn_simdhash_concurrent_u32_ptr_clear (dn_simdhash_concurrent_u32_ptr_t *hash);
+
+uint32_t
+dn_simdhash_concurrent_u32_ptr_count (dn_simdhash_concurrent_u32_ptr_t *hash);
+
+typedef void (*dn_simdhash_concurrent_u32_ptr_foreach_func) (uint32_t key, void *value, void *user_data);
+
+// Takes the writer lock for the duration of the iteration so the callback
+//  sees a consistent snapshot; do not call back into the same table.
+void
+dn_simdhash_concurrent_u32_ptr_foreach (dn_simdhash_concurrent_u32_ptr_t *hash, dn_simdhash_concurrent_u32_ptr_foreach_func func, void *user_data);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // __DN_SIMDHASH_CONCURRENT_U32_PTR_H__
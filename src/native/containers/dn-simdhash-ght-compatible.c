@@ -116,6 +116,10 @@ dn_simdhash_ght_insert_replace (
 )
 {
 	check_self(hash);
+
+	// Chip away at any migration left over from an earlier grow.
+	migrate_pending_buckets(hash);
+
 	uint32_t key_hash = DN_SIMDHASH_KEY_HASHER(DN_SIMDHASH_GET_DATA(hash), key);
 	dn_simdhash_insert_mode imode = overwrite_key
 		? DN_SIMDHASH_INSERT_MODE_OVERWRITE_KEY_AND_VALUE
@@ -125,8 +129,20 @@ dn_simdhash_ght_insert_replace (
 	if (ok == DN_SIMDHASH_INSERT_NEED_TO_GROW) {
 		dn_simdhash_buffers_t old_buffers = dn_simdhash_ensure_capacity_internal(hash, dn_simdhash_capacity(hash) + 1);
 		if (old_buffers.buckets) {
-			DN_SIMDHASH_REHASH_INTERNAL(hash, old_buffers);
-			dn_simdhash_free_buffers(old_buffers);
+			// If the previous migration somehow hasn't finished yet, drain it now;
+			//  normally it completes long before the table fills up again.
+			if (dn_simdhash_migration_in_progress(hash)) {
+				dn_simdhash_buffers_t pending = hash->old_buffers;
+				memset(&hash->old_buffers, 0, sizeof(hash->old_buffers));
+				hash->migration_cursor = 0;
+				DN_SIMDHASH_REHASH_INTERNAL(hash, pending);
+				dn_simdhash_free_buffers(pending);
+			}
+			// Migrate the retired buffers incrementally instead of rehashing
+			//  everything up front.
+			hash->old_buffers = old_buffers;
+			hash->migration_cursor = 0;
+			migrate_pending_buckets(hash);
 		}
 		ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(hash, key, key_hash, value, imode);
 	}
@@ -273,25 +273,36 @@ adjust_cascaded_counts (dn_simdhash_buffers_t buffers, uint32_t first_bucket_ind
 }
 
 static DN_FORCEINLINE(DN_SIMDHASH_VALUE_T *)
-DN_SIMDHASH_FIND_VALUE_INTERNAL (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
+find_value_in_buffers (DN_SIMDHASH_T_PTR hash, dn_simdhash_buffers_t buffers, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
 {
 	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
-	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(hash->buffers, key_hash);
+	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(buffers, key_hash);
 	dn_simdhash_search_vector search_vector = build_search_vector(suffix);
 
-	BEGIN_SCAN_BUCKETS(hash->buffers, first_bucket_index, bucket_index, bucket_address)
+	BEGIN_SCAN_BUCKETS(buffers, first_bucket_index, bucket_index, bucket_address)
 		int index_in_bucket = DN_SIMDHASH_SCAN_BUCKET_INTERNAL(hash, bucket_address, key, search_vector);
 		if (index_in_bucket >= 0) {
 			uint32_t value_slot_index = (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + index_in_bucket;
-			return address_of_value(hash->buffers, value_slot_index);
+			return address_of_value(buffers, value_slot_index);
 		} else if (index_in_bucket == DN_SIMDHASH_SCAN_BUCKET_NO_OVERFLOW) {
 			return NULL;
 		}
-	END_SCAN_BUCKETS(hash->buffers, first_bucket_index, bucket_index, bucket_address)
+	END_SCAN_BUCKETS(buffers, first_bucket_index, bucket_index, bucket_address)
 
 	return NULL;
 }
 
+static DN_FORCEINLINE(DN_SIMDHASH_VALUE_T *)
+DN_SIMDHASH_FIND_VALUE_INTERNAL (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
+{
+	DN_SIMDHASH_VALUE_T *result = find_value_in_buffers(hash, hash->buffers, key, key_hash);
+	// While a grow is being migrated incrementally, unmigrated items still live
+	//  in the retired generation, so a miss has to probe there too.
+	if (!result && dn_simdhash_migration_in_progress(hash))
+		result = find_value_in_buffers(hash, hash->old_buffers, key, key_hash);
+	return result;
+}
+
 typedef enum dn_simdhash_insert_mode {
 	// Ensures that no matching key exists in the hash, then adds the key/value pair
 	DN_SIMDHASH_INSERT_MODE_ENSURE_UNIQUE,
@@ -305,11 +316,11 @@ typedef enum dn_simdhash_insert_mode {
 
 static void
 do_overwrite (
-	DN_SIMDHASH_T_PTR hash, uint32_t bucket_index, bucket_t *bucket_address, int index_in_bucket,
+	DN_SIMDHASH_T_PTR hash, dn_simdhash_buffers_t buffers, uint32_t bucket_index, bucket_t *bucket_address, int index_in_bucket,
 	DN_SIMDHASH_KEY_T key, DN_SIMDHASH_VALUE_T value, uint8_t overwrite_key
 ) {
 	DN_SIMDHASH_KEY_T *key_ptr = &bucket_address->keys[index_in_bucket];
-	DN_SIMDHASH_VALUE_T *value_ptr = address_of_value(hash->buffers, (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + index_in_bucket);
+	DN_SIMDHASH_VALUE_T *value_ptr = address_of_value(buffers, (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + index_in_bucket);
 #if DN_SIMDHASH_HAS_REPLACE_HANDLER
 	DN_SIMDHASH_KEY_T old_key = *key_ptr;
 	DN_SIMDHASH_VALUE_T old_value = *value_ptr;
@@ -322,16 +333,58 @@ do_overwrite (
 #endif
 }
 
+// Checks the retired generation for a matching key so that inserts can't create
+//  a duplicate of an item that hasn't been migrated yet. If the key was found,
+//  performs the mode-appropriate action in place, fills result, and returns 1.
+static uint8_t
+check_old_generation_for_insert (
+	DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash, DN_SIMDHASH_VALUE_T value,
+	dn_simdhash_insert_mode mode, dn_simdhash_insert_result *result
+) {
+	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
+	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(hash->old_buffers, key_hash);
+	dn_simdhash_search_vector search_vector = build_search_vector(suffix);
+
+	BEGIN_SCAN_BUCKETS(hash->old_buffers, first_bucket_index, bucket_index, bucket_address)
+		int index_in_bucket = DN_SIMDHASH_SCAN_BUCKET_INTERNAL(hash, bucket_address, key, search_vector);
+		if (index_in_bucket >= 0) {
+			if (
+				(mode == DN_SIMDHASH_INSERT_MODE_OVERWRITE_KEY_AND_VALUE) ||
+				(mode == DN_SIMDHASH_INSERT_MODE_OVERWRITE_VALUE)
+			) {
+				// Overwrite the item where it lives; it will migrate later.
+				do_overwrite (
+					hash, hash->old_buffers, bucket_index, bucket_address, index_in_bucket,
+					key, value, (mode == DN_SIMDHASH_INSERT_MODE_OVERWRITE_KEY_AND_VALUE)
+				);
+				*result = DN_SIMDHASH_INSERT_OK_OVERWROTE_EXISTING;
+			} else
+				*result = DN_SIMDHASH_INSERT_KEY_ALREADY_PRESENT;
+			return 1;
+		} else if (index_in_bucket == DN_SIMDHASH_SCAN_BUCKET_NO_OVERFLOW)
+			return 0;
+	END_SCAN_BUCKETS(hash->old_buffers, first_bucket_index, bucket_index, bucket_address)
+
+	return 0;
+}
+
 static dn_simdhash_insert_result
 DN_SIMDHASH_TRY_INSERT_INTERNAL (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash, DN_SIMDHASH_VALUE_T value, dn_simdhash_insert_mode mode)
 {
 	// HACK: Early out. Better to grow without scanning here.
-	// We're comparing with the computed grow_at_count threshold to maintain an appropriate load factor
-	if (hash->count >= hash->grow_at_count) {
+	// We're comparing with the computed grow_at_count threshold to maintain an appropriate load factor.
+	// Rehashing/migration inserts bypass this; they move existing items, so count doesn't change.
+	if ((mode != DN_SIMDHASH_INSERT_MODE_REHASHING) && (hash->count >= hash->grow_at_count)) {
 		// printf ("hash->count %d >= hash->grow_at_count %d\n", hash->count, hash->grow_at_count);
 		return DN_SIMDHASH_INSERT_NEED_TO_GROW;
 	}
 
+	if ((mode != DN_SIMDHASH_INSERT_MODE_REHASHING) && dn_simdhash_migration_in_progress(hash)) {
+		dn_simdhash_insert_result old_generation_result;
+		if (check_old_generation_for_insert(hash, key, key_hash, value, mode, &old_generation_result))
+			return old_generation_result;
+	}
+
 	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
 	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(hash->buffers, key_hash);
 	dn_simdhash_search_vector search_vector = build_search_vector(suffix);
@@ -346,7 +399,7 @@ DN_SIMDHASH_TRY_INSERT_INTERNAL (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key,
 					(mode == DN_SIMDHASH_INSERT_MODE_OVERWRITE_VALUE)
 				) {
 					do_overwrite (
-						hash, bucket_index, bucket_address, index_in_bucket,
+						hash, hash->buffers, bucket_index, bucket_address, index_in_bucket,
 						key, value, (mode == DN_SIMDHASH_INSERT_MODE_OVERWRITE_KEY_AND_VALUE)
 					);
 					return DN_SIMDHASH_INSERT_OK_OVERWROTE_EXISTING;
@@ -401,13 +454,67 @@ DN_SIMDHASH_REHASH_INTERNAL (DN_SIMDHASH_T_PTR hash, dn_simdhash_buffers_t old_b
 	END_SCAN_PAIRS(old_buffers, key_address, value_address)
 }
 
+// Moves up to DN_SIMDHASH_MIGRATION_CHUNK_SIZE buckets from the retired
+//  generation into the current buffers. Mutating operations call this so the
+//  cost of a grow is amortized across many operations instead of being paid
+//  as one full-table rehash. Frees the retired buffers once they're empty.
+static void
+migrate_pending_buckets (DN_SIMDHASH_T_PTR hash)
+{
+	if (!dn_simdhash_migration_in_progress(hash))
+		return;
+
+	dn_simdhash_buffers_t old_buffers = hash->old_buffers;
+	uint32_t bucket_index = hash->migration_cursor,
+		end_index = bucket_index + DN_SIMDHASH_MIGRATION_CHUNK_SIZE;
+	if (end_index > old_buffers.buckets_length)
+		end_index = old_buffers.buckets_length;
+
+	for (; bucket_index < end_index; bucket_index++) {
+		bucket_t *bucket_address = address_of_bucket(old_buffers, bucket_index);
+		uint32_t bucket_count = dn_simdhash_bucket_count(bucket_address->suffixes);
+		for (uint32_t index_in_bucket = 0; index_in_bucket < bucket_count; index_in_bucket++) {
+			DN_SIMDHASH_KEY_T *key_address = &bucket_address->keys[index_in_bucket];
+			DN_SIMDHASH_VALUE_T *value_address = address_of_value(old_buffers, (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + index_in_bucket);
+			uint32_t key_hash = DN_SIMDHASH_KEY_HASHER(DN_SIMDHASH_GET_DATA(hash), *key_address);
+			// This theoretically can't fail, see DN_SIMDHASH_REHASH_INTERNAL.
+			dn_simdhash_insert_result ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(
+				hash, *key_address, key_hash,
+				*value_address,
+				DN_SIMDHASH_INSERT_MODE_REHASHING
+			);
+			dn_simdhash_assert(ok == DN_SIMDHASH_INSERT_OK_ADDED_NEW);
+		}
+		// Empty the bucket so probes of the retired generation can't see stale
+		//  copies of the items we just moved. The cascade counter is left alone;
+		//  it only makes scans conservative, never incorrect.
+		dn_simdhash_bucket_set_count(bucket_address->suffixes, 0);
+	}
+
+	hash->migration_cursor = bucket_index;
+	if (bucket_index >= old_buffers.buckets_length) {
+		memset(&hash->old_buffers, 0, sizeof(hash->old_buffers));
+		hash->migration_cursor = 0;
+		dn_simdhash_free_buffers(old_buffers);
+	}
+}
+
 #if DN_SIMDHASH_HAS_REMOVE_HANDLER
 static void
 DN_SIMDHASH_DESTROY_ALL (DN_SIMDHASH_T_PTR hash)
 {
-	BEGIN_SCAN_PAIRS(hash->buffers, key_address, value_address)
-		DN_SIMDHASH_ON_REMOVE(DN_SIMDHASH_GET_DATA(hash), *key_address, *value_address);
-	END_SCAN_PAIRS(hash->buffers, key_address, value_address)
+	{
+		BEGIN_SCAN_PAIRS(hash->buffers, key_address, value_address)
+			DN_SIMDHASH_ON_REMOVE(DN_SIMDHASH_GET_DATA(hash), *key_address, *value_address);
+		END_SCAN_PAIRS(hash->buffers, key_address, value_address)
+	}
+	// Items that haven't been migrated out of the retired generation yet still
+	//  need their remove handler invoked
+	if (dn_simdhash_migration_in_progress(hash)) {
+		BEGIN_SCAN_PAIRS(hash->old_buffers, key_address, value_address)
+			DN_SIMDHASH_ON_REMOVE(DN_SIMDHASH_GET_DATA(hash), *key_address, *value_address);
+		END_SCAN_PAIRS(hash->old_buffers, key_address, value_address)
+	}
 }
 #endif
 
@@ -445,12 +552,27 @@ DN_SIMDHASH_TRY_ADD_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, ui
 {
 	check_self(hash);
 
+	// Chip away at any migration left over from an earlier grow.
+	migrate_pending_buckets(hash);
+
 	dn_simdhash_insert_result ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(hash, key, key_hash, value, DN_SIMDHASH_INSERT_MODE_ENSURE_UNIQUE);
 	if (ok == DN_SIMDHASH_INSERT_NEED_TO_GROW) {
 		dn_simdhash_buffers_t old_buffers = dn_simdhash_ensure_capacity_internal(hash, dn_simdhash_capacity(hash) + 1);
 		if (old_buffers.buckets) {
-			DN_SIMDHASH_REHASH_INTERNAL(hash, old_buffers);
-			dn_simdhash_free_buffers(old_buffers);
+			// If the previous migration somehow hasn't finished yet, drain it now;
+			//  normally it completes long before the table fills up again.
+			if (dn_simdhash_migration_in_progress(hash)) {
+				dn_simdhash_buffers_t pending = hash->old_buffers;
+				memset(&hash->old_buffers, 0, sizeof(hash->old_buffers));
+				hash->migration_cursor = 0;
+				DN_SIMDHASH_REHASH_INTERNAL(hash, pending);
+				dn_simdhash_free_buffers(pending);
+			}
+			// Migrate the retired buffers incrementally instead of rehashing
+			//  everything up front.
+			hash->old_buffers = old_buffers;
+			hash->migration_cursor = 0;
+			migrate_pending_buckets(hash);
 		}
 		ok = DN_SIMDHASH_TRY_INSERT_INTERNAL(hash, key, key_hash, value, DN_SIMDHASH_INSERT_MODE_ENSURE_UNIQUE);
 	}
@@ -504,16 +626,14 @@ DN_SIMDHASH_TRY_REMOVE (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key)
 	return DN_SIMDHASH_TRY_REMOVE_WITH_HASH(hash, key, key_hash);
 }
 
-uint8_t
-DN_SIMDHASH_TRY_REMOVE_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
+static uint8_t
+try_remove_from_buffers (DN_SIMDHASH_T_PTR hash, dn_simdhash_buffers_t buffers, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
 {
-	check_self(hash);
-
 	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
-	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(hash->buffers, key_hash);
+	uint32_t first_bucket_index = dn_simdhash_select_bucket_index(buffers, key_hash);
 	dn_simdhash_search_vector search_vector = build_search_vector(suffix);
 
-	BEGIN_SCAN_BUCKETS(hash->buffers, first_bucket_index, bucket_index, bucket_address)
+	BEGIN_SCAN_BUCKETS(buffers, first_bucket_index, bucket_index, bucket_address)
 		int index_in_bucket = DN_SIMDHASH_SCAN_BUCKET_INTERNAL(hash, bucket_address, key, search_vector);
 		if (index_in_bucket >= 0) {
 			// We found the item. Replace it with the last item in the bucket, then erase
@@ -523,8 +643,8 @@ DN_SIMDHASH_TRY_REMOVE_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key,
 			uint32_t value_slot_index = (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + index_in_bucket,
 				replacement_value_slot_index = (bucket_index * DN_SIMDHASH_BUCKET_CAPACITY) + replacement_index_in_bucket;
 
-			DN_SIMDHASH_VALUE_T *value_address = address_of_value(hash->buffers, value_slot_index);
-			DN_SIMDHASH_VALUE_T *replacement_address = address_of_value(hash->buffers, replacement_value_slot_index);
+			DN_SIMDHASH_VALUE_T *value_address = address_of_value(buffers, value_slot_index);
+			DN_SIMDHASH_VALUE_T *replacement_address = address_of_value(buffers, replacement_value_slot_index);
 			DN_SIMDHASH_KEY_T *key_address = &bucket_address->keys[index_in_bucket];
 			DN_SIMDHASH_KEY_T *replacement_key_address = &bucket_address->keys[replacement_index_in_bucket];
 
@@ -562,7 +682,7 @@ DN_SIMDHASH_TRY_REMOVE_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key,
 			//  to go through all the buckets we visited on the way here and reduce
 			//  their cascade counters (if possible), to maintain better scan performance.
 			if (bucket_index != first_bucket_index)
-				adjust_cascaded_counts(hash->buffers, first_bucket_index, bucket_index, 0);
+				adjust_cascaded_counts(buffers, first_bucket_index, bucket_index, 0);
 
 #if DN_SIMDHASH_HAS_REMOVE_HANDLER
 			// We've finished removing the item, so we're in a consistent state and can notify
@@ -572,11 +692,27 @@ DN_SIMDHASH_TRY_REMOVE_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key,
 			return 1;
 		} else if (index_in_bucket == DN_SIMDHASH_SCAN_BUCKET_NO_OVERFLOW)
 			return 0;
-	END_SCAN_BUCKETS(hash->buffers, first_bucket_index, bucket_index, bucket_address)
+	END_SCAN_BUCKETS(buffers, first_bucket_index, bucket_index, bucket_address)
 
 	return 0;
 }
 
+uint8_t
+DN_SIMDHASH_TRY_REMOVE_WITH_HASH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, uint32_t key_hash)
+{
+	check_self(hash);
+
+	// Chip away at any migration left over from an earlier grow.
+	migrate_pending_buckets(hash);
+
+	if (try_remove_from_buffers(hash, hash->buffers, key, key_hash))
+		return 1;
+	// The item may not have been migrated out of the retired generation yet.
+	if (dn_simdhash_migration_in_progress(hash))
+		return try_remove_from_buffers(hash, hash->old_buffers, key, key_hash);
+	return 0;
+}
+
 uint8_t
 DN_SIMDHASH_TRY_REPLACE_VALUE (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_KEY_T key, DN_SIMDHASH_VALUE_T new_value)
 {
@@ -610,8 +746,17 @@ DN_SIMDHASH_FOREACH (DN_SIMDHASH_T_PTR hash, DN_SIMDHASH_FOREACH_FUNC func, void
 	check_self(hash);
 	dn_simdhash_assert(func);
 
-	dn_simdhash_buffers_t buffers = hash->buffers;
-	BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
-		func(*key_address, *value_address, user_data);
-	END_SCAN_PAIRS(buffers, key_address, value_address)
+	{
+		dn_simdhash_buffers_t buffers = hash->buffers;
+		BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
+			func(*key_address, *value_address, user_data);
+		END_SCAN_PAIRS(buffers, key_address, value_address)
+	}
+	// Items that haven't been migrated out of the retired generation yet
+	if (dn_simdhash_migration_in_progress(hash)) {
+		dn_simdhash_buffers_t buffers = hash->old_buffers;
+		BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
+			func(*key_address, *value_address, user_data);
+		END_SCAN_PAIRS(buffers, key_address, value_address)
+	}
 }
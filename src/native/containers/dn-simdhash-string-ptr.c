@@ -86,8 +86,17 @@ dn_simdhash_string_ptr_foreach (dn_simdhash_string_ptr_t *hash, dn_simdhash_stri
 	assert(hash);
 	assert(func);
 
-	dn_simdhash_buffers_t buffers = hash->buffers;
-	BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
-		func(key_address->text, *value_address, user_data);
-	END_SCAN_PAIRS(buffers, key_address, value_address)
+	{
+		dn_simdhash_buffers_t buffers = hash->buffers;
+		BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
+			func(key_address->text, *value_address, user_data);
+		END_SCAN_PAIRS(buffers, key_address, value_address)
+	}
+	// Items that haven't been migrated out of the retired generation yet
+	if (dn_simdhash_migration_in_progress(hash)) {
+		dn_simdhash_buffers_t buffers = hash->old_buffers;
+		BEGIN_SCAN_PAIRS(buffers, key_address, value_address)
+			func(key_address->text, *value_address, user_data);
+		END_SCAN_PAIRS(buffers, key_address, value_address)
+	}
 }
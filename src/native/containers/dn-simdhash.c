@@ -40,9 +40,11 @@ dn_simdhash_free (dn_simdhash_t *hash)
 	dn_simdhash_assert(hash);
 	if (hash->vtable.destroy_all)
 		hash->vtable.destroy_all(hash);
-	dn_simdhash_buffers_t buffers = hash->buffers;
+	dn_simdhash_buffers_t buffers = hash->buffers,
+		old_buffers = hash->old_buffers;
 	memset(hash, 0, sizeof(dn_simdhash_t));
 	dn_simdhash_free_buffers(buffers);
+	dn_simdhash_free_buffers(old_buffers);
 	dn_allocator_free(buffers.allocator, (void *)hash);
 }
 
@@ -119,6 +121,12 @@ dn_simdhash_clear (dn_simdhash_t *hash)
 	if (hash->vtable.destroy_all)
 		hash->vtable.destroy_all(hash);
 	hash->count = 0;
+	// Any items still waiting to be migrated are going away too
+	if (dn_simdhash_migration_in_progress(hash)) {
+		dn_simdhash_free_buffers(hash->old_buffers);
+		memset(&hash->old_buffers, 0, sizeof(hash->old_buffers));
+		hash->migration_cursor = 0;
+	}
 	// TODO: Implement a fast clear algorithm that scans buckets and only clears ones w/nonzero count
 	memset(hash->buffers.buckets, 0, hash->buffers.buckets_length * hash->meta->bucket_size_bytes);
 	// Skip this for performance; memset is especially slow in wasm
@@ -159,6 +167,16 @@ dn_simdhash_ensure_capacity (dn_simdhash_t *hash, uint32_t capacity)
 	capacity = compute_adjusted_capacity(capacity);
 	dn_simdhash_buffers_t old_buffers = dn_simdhash_ensure_capacity_internal(hash, capacity);
 	if (old_buffers.buckets) {
+		// An explicit resize pays the full rehash cost up front, so finish any
+		//  incremental migration that was still in progress before rehashing the
+		//  buffers we just retired.
+		if (dn_simdhash_migration_in_progress(hash)) {
+			dn_simdhash_buffers_t pending = hash->old_buffers;
+			memset(&hash->old_buffers, 0, sizeof(hash->old_buffers));
+			hash->migration_cursor = 0;
+			hash->vtable.rehash(hash, pending);
+			dn_simdhash_free_buffers(pending);
+		}
 		hash->vtable.rehash(hash, old_buffers);
 		dn_simdhash_free_buffers(old_buffers);
 	}
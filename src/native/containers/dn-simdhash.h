@@ -26,6 +26,11 @@
 // User-specified capacity values will be increased to this percentage in order
 //  to maintain an ideal load factor. FIXME: 120 isn't right
 #define DN_SIMDHASH_SIZING_PERCENTAGE 120
+// After a grow, buckets from the retired generation are migrated into the new
+//  one this many buckets at a time by subsequent mutating operations, instead of
+//  rehashing the whole table up front. This bounds the worst-case latency of a
+//  single operation regardless of table size.
+#define DN_SIMDHASH_MIGRATION_CHUNK_SIZE 8
 
 typedef struct dn_simdhash_void_data_t {
 	// HACK: Empty struct or 0-element array produce a MSVC warning and break the build.
@@ -71,6 +76,12 @@ typedef struct dn_simdhash_t {
 	// internal state
 	uint32_t count, grow_at_count;
 	dn_simdhash_buffers_t buffers;
+	// The retired generation left over from the most recent grow, if its items
+	//  haven't all been migrated into the current buffers yet. buckets is NULL
+	//  once migration is complete (or if no grow has happened).
+	dn_simdhash_buffers_t old_buffers;
+	// Index of the next bucket in old_buffers to migrate.
+	uint32_t migration_cursor;
 	dn_simdhash_vtable_t vtable;
 	dn_simdhash_meta_t *meta;
 	// We allocate extra space here based on meta.data_size
@@ -112,6 +123,11 @@ dn_simdhash_select_suffix (uint32_t key_hash)
 #define dn_simdhash_select_bucket_index(buffers, key_hash) \
 	((key_hash) & ((buffers).buckets_length - 1))
 
+// Nonzero if a grow has happened and some items still live in the retired
+//  generation (so lookups have to probe both generations).
+#define dn_simdhash_migration_in_progress(hash) \
+	((hash)->old_buffers.buckets != NULL)
+
 
 // Creates a simdhash with the provided configuration metadata, vtable, size, and allocator.
 // Be sure you know what you're doing.
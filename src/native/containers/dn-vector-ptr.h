@@ -7,6 +7,7 @@
 #include "dn-vector-t.h"
 
 DN_DEFINE_VECTOR_T (ptr, void *)
+DN_DEFINE_VECTOR_SMALL_T (ptr, void *, 8)
 
 #define DN_VECTOR_PTR_FOREACH_BEGIN(var_type, var_name, vector) do { \
 	var_type var_name; \
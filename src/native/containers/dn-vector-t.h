@@ -310,4 +310,50 @@ DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, find) (const DN_DEFINE_VECTOR_T_NAME(name)
 	return found; \
 }
 
+#define DN_DEFINE_VECTOR_SMALL_T_NAME(name) \
+	dn_vector_ ## name ## _small_t
+
+/* Defines a small-buffer-optimized companion to an existing DN_DEFINE_VECTOR_T
+ * instantiation. The first inline_capacity elements are stored inside the
+ * struct itself (typically on the stack), so the dominant tiny-vector case
+ * does zero heap allocations; the heap is only touched if the vector outgrows
+ * the inline storage. All regular accessors work through the embedded .vector
+ * member. Because the vector's allocator points into the struct, it must stay
+ * at a stable address while in use and must not be copied by value. */
+#define DN_DEFINE_VECTOR_SMALL_T(name, type, inline_capacity) \
+typedef struct _dn_vector_ ## name ## _small_t DN_DEFINE_VECTOR_SMALL_T_NAME(name); \
+struct _dn_vector_ ## name ## _small_t { \
+	DN_DEFINE_VECTOR_T_NAME(name) vector; \
+	struct { \
+		dn_allocator_fixed_or_malloc_t _allocator; \
+		/* inline element storage plus room for the allocation header and alignment */ \
+		uint8_t _storage [(sizeof (type) * (inline_capacity)) + 32]; \
+	} _internal; \
+}; \
+static inline bool \
+DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_custom_init) (DN_DEFINE_VECTOR_SMALL_T_NAME(name) *vector, uint32_t attributes) \
+{ \
+	DN_ASSERT (vector); \
+	if (DN_UNLIKELY (!dn_allocator_fixed_or_malloc_init (&vector->_internal._allocator, vector->_internal._storage, sizeof (vector->_internal._storage)))) \
+		return false; \
+	DN_DEFINE_VECTOR_CUSTOM_ALLOC_INIT_T_SYMBOL_NAME(name) params = { (dn_allocator_t *)&vector->_internal._allocator, (inline_capacity), attributes }; \
+	return DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, custom_init) (&vector->vector, &params); \
+} \
+static inline bool \
+DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_init) (DN_DEFINE_VECTOR_SMALL_T_NAME(name) *vector) \
+{ \
+	return DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_custom_init) (vector, 0); \
+} \
+static inline void \
+DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_custom_dispose) (DN_DEFINE_VECTOR_SMALL_T_NAME(name) *vector, dn_vector_dispose_func_t dispose_func) \
+{ \
+	DN_ASSERT (vector); \
+	dn_vector_custom_dispose ((dn_vector_t *)&vector->vector, dispose_func); \
+} \
+static inline void \
+DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_dispose) (DN_DEFINE_VECTOR_SMALL_T_NAME(name) *vector) \
+{ \
+	DN_DEFINE_VECTOR_T_SYMBOL_NAME(name, small_custom_dispose) (vector, NULL); \
+}
+
 #endif /* __DN_VECTOR_T_H__ */
@@ -162,6 +162,18 @@ dn_vector_init (
 #define dn_vector_init_t(vector, element_type) \
 	dn_vector_init (vector, sizeof (element_type))
 
+/* Declares and initializes a local vector named var_name whose first
+ * inline_capacity elements live in a stack buffer; the heap is only touched if
+ * the vector outgrows it. Pair with dn_vector_dispose, and don't return the
+ * vector or its data from the declaring scope. */
+#define DN_VECTOR_LOCAL_T(var_name, element_type, inline_capacity) \
+	uint8_t __buffer_ ## var_name [(sizeof (element_type) * (inline_capacity)) + 32]; \
+	dn_allocator_fixed_or_malloc_t __allocator_ ## var_name; \
+	dn_allocator_fixed_or_malloc_init (&__allocator_ ## var_name, __buffer_ ## var_name, sizeof (__buffer_ ## var_name)); \
+	dn_vector_custom_alloc_params_t __params_ ## var_name = { (dn_allocator_t *)&__allocator_ ## var_name, (inline_capacity), 0 }; \
+	dn_vector_t var_name; \
+	dn_vector_custom_init_t (&var_name, &__params_ ## var_name, element_type);
+
 void
 dn_vector_custom_dispose (
 	dn_vector_t *vector,
@@ -2,6 +2,14 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "ghashtable.h"
+#include "../dn-simdhash-concurrent-u32-ptr.h"
+
+// The multi-threaded scenarios need a thread API; wasm and MSVC builds of the
+//  harness just skip them.
+#if !defined(_MSC_VER) && !defined(__wasm)
+#define BENCHMARK_HAS_THREADS 1
+#include <pthread.h>
+#endif
 
 #ifndef MEASUREMENTS_IMPLEMENTATION
 #define MEASUREMENTS_IMPLEMENTATION 1
@@ -132,6 +140,40 @@ static void destroy_instance_ght (void *data) {
     g_hash_table_destroy((GHashTable *)data);
 }
 
+
+static void * create_instance_concurrent_u32_ptr_random_values () {
+    if (!random_u32s)
+        init_data();
+
+    dn_simdhash_concurrent_u32_ptr_t *result = dn_simdhash_concurrent_u32_ptr_new(INNER_COUNT, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+        dn_simdhash_concurrent_u32_ptr_try_add(result, key, (void *)(size_t)i);
+    }
+    return result;
+}
+
+static void destroy_instance_concurrent_u32_ptr (void *data) {
+    dn_simdhash_concurrent_u32_ptr_free((dn_simdhash_concurrent_u32_ptr_t *)data);
+}
+
+#ifdef BENCHMARK_HAS_THREADS
+#define CONCURRENT_READER_COUNT 4
+
+// Looks up every key once; keys may be concurrently removed by the writer
+//  scenario, so only validate the value when the key was found.
+static void * concurrent_reader_thread (void *_data) {
+    dn_simdhash_concurrent_u32_ptr_t *data = _data;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+        void *temp = NULL;
+        if (dn_simdhash_concurrent_u32_ptr_try_get_value(data, key, &temp))
+            dn_simdhash_assert(temp == (void *)(size_t)i);
+    }
+    return NULL;
+}
+#endif // BENCHMARK_HAS_THREADS
+
 #endif // MEASUREMENTS_IMPLEMENTATION
 
 // These go outside the guard because we include this file multiple times.
@@ -217,3 +259,40 @@ MEASUREMENT(ght_find_missing_key, GHashTable *, create_instance_ght_random_value
         dn_simdhash_assert(g_hash_table_lookup(data, (gpointer)(size_t)key) == NULL);
     }
 })
+
+// Single-threaded read through the concurrent wrapper, to measure the
+//  sequence-counter overhead relative to dn_find_random_keys
+MEASUREMENT(dn_concurrent_find_random_keys, dn_simdhash_concurrent_u32_ptr_t *, create_instance_concurrent_u32_ptr_random_values, destroy_instance_concurrent_u32_ptr, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+        void *temp = NULL;
+        dn_simdhash_assert(dn_simdhash_concurrent_u32_ptr_try_get_value(data, key, &temp));
+        dn_simdhash_assert(temp == (void *)(size_t)i);
+    }
+})
+
+#ifdef BENCHMARK_HAS_THREADS
+// Read scaling: all readers scan the whole table with no writer active
+MEASUREMENT(dn_concurrent_find_random_keys_multi_reader, dn_simdhash_concurrent_u32_ptr_t *, create_instance_concurrent_u32_ptr_random_values, destroy_instance_concurrent_u32_ptr, {
+    pthread_t readers[CONCURRENT_READER_COUNT];
+    for (int i = 0; i < CONCURRENT_READER_COUNT; i++)
+        dn_simdhash_assert(pthread_create(&readers[i], NULL, concurrent_reader_thread, data) == 0);
+    for (int i = 0; i < CONCURRENT_READER_COUNT; i++)
+        pthread_join(readers[i], NULL);
+})
+
+// Readers racing an active writer: the main thread removes and re-adds every
+//  item while the readers scan
+MEASUREMENT(dn_concurrent_readers_during_writes, dn_simdhash_concurrent_u32_ptr_t *, create_instance_concurrent_u32_ptr_random_values, destroy_instance_concurrent_u32_ptr, {
+    pthread_t readers[CONCURRENT_READER_COUNT];
+    for (int i = 0; i < CONCURRENT_READER_COUNT; i++)
+        dn_simdhash_assert(pthread_create(&readers[i], NULL, concurrent_reader_thread, data) == 0);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(random_u32s, uint32_t, i);
+        dn_simdhash_assert(dn_simdhash_concurrent_u32_ptr_try_remove(data, key));
+        dn_simdhash_assert(dn_simdhash_concurrent_u32_ptr_try_add(data, key, (void *)(size_t)i));
+    }
+    for (int i = 0; i < CONCURRENT_READER_COUNT; i++)
+        pthread_join(readers[i], NULL);
+})
+#endif // BENCHMARK_HAS_THREADS
@@ -5,6 +5,7 @@
 
 #include "pal.h"
 #include "fxr_resolver.h"
+#include "startup_timing.h"
 #include "trace.h"
 #include "hostfxr_resolver.h"
 
@@ -40,6 +41,7 @@ hostfxr_resolver_t::hostfxr_resolver_t(const pal::string_t& app_root)
     }
     else if (pal::load_library(&m_fxr_path, &m_hostfxr_dll))
     {
+        startup_timing::report();
         m_status_code = StatusCode::Success;
     }
     else
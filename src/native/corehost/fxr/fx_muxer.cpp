@@ -5,6 +5,7 @@
 #include <cassert>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <error_codes.h>
 #include <pal.h>
 #include <trace.h>
@@ -363,6 +364,26 @@ namespace
         return probe_realpaths;
     }
 
+    // Warm the page cache for the runtime binaries the host is about to load.
+    // The runtime is loaded from the same directory hostpolicy was resolved to
+    // (the root framework for framework-dependent apps, the app directory for
+    // self-contained ones), so kicking off readahead on a background thread here
+    // overlaps the disk reads with hostpolicy load and .deps.json processing.
+    // This is purely a cache hint - binaries that do not exist are ignored.
+    void readahead_runtime_binaries(const pal::string_t& impl_dir)
+    {
+        std::thread([impl_dir]()
+        {
+            const pal::char_t* binaries[] = { LIBCORECLR_NAME, LIB_FILE_NAME_X("clrjit"), CORELIB_NAME };
+            for (const pal::char_t* binary : binaries)
+            {
+                pal::string_t path = impl_dir;
+                append_path(&path, binary);
+                pal::file_readahead(path);
+            }
+        }).detach();
+    }
+
     int get_init_info_for_app(
         const pal::string_t &host_command,
         const host_startup_info_t &host_info,
@@ -495,6 +516,8 @@ namespace
             return StatusCode::CoreHostLibMissingFailure;
         }
 
+        readahead_runtime_binaries(hostpolicy_dir);
+
         init.reset(new corehost_init_t(host_command, host_info, deps_file, additional_deps_serialized, probe_realpaths, mode, fx_definitions, additional_properties));
 
         return StatusCode::Success;
@@ -4,6 +4,7 @@
 #include <pal.h>
 #include "fxr_resolver.h"
 #include <fx_ver.h>
+#include <startup_timing.h>
 #include <trace.h>
 #include <utils.h>
 
@@ -54,6 +55,7 @@ namespace
 
 bool fxr_resolver::try_get_path(const pal::string_t& root_path, pal::string_t* out_dotnet_root, pal::string_t* out_fxr_path)
 {
+    startup_timing::scope_t timing{ startup_timing::phase::hostfxr_resolution };
 #if defined(FEATURE_APPHOST) || defined(FEATURE_LIBHOST)
     // For apphost and libhost, root_path is expected to be a directory.
     // For libhost, it may be empty if app-local search is not desired (e.g. com/ijw/winrt hosts, nethost when no assembly path is specified)
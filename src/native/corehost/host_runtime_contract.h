@@ -23,6 +23,16 @@
 #define HOST_PROPERTY_PLATFORM_RESOURCE_ROOTS "PLATFORM_RESOURCE_ROOTS"
 #define HOST_PROPERTY_TRUSTED_PLATFORM_ASSEMBLIES "TRUSTED_PLATFORM_ASSEMBLIES"
 
+// Startup timing measured by the host. Durations are in microseconds;
+// a value of zero indicates the phase was not measured.
+struct host_runtime_startup_timing
+{
+    size_t size;
+    uint64_t deps_resolution_us;     // parsing .deps.json files and resolving probing paths
+    uint64_t runtime_load_us;        // locating and loading the runtime library
+    uint64_t runtime_initialize_us;  // initializing the runtime (coreclr_initialize)
+};
+
 struct host_runtime_contract
 {
     size_t size;
@@ -51,6 +61,12 @@ struct host_runtime_contract
     const void* (HOST_CONTRACT_CALLTYPE* pinvoke_override)(
         const char* library_name,
         const char* entry_point_name);
+
+    // Get startup timing measured by the host. The caller sets `timing->size` before calling.
+    // Returns true if `timing` was populated, false if timing information is not available
+    // or `timing->size` is smaller than the structure the host was built with.
+    bool(HOST_CONTRACT_CALLTYPE* get_startup_timing)(
+        /*inout*/ struct host_runtime_startup_timing* timing);
 };
 
 #endif // __HOST_RUNTIME_CONTRACT_H__
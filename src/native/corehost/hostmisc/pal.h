@@ -280,6 +280,10 @@ namespace pal
     const void* mmap_read(const string_t& path, size_t* length = nullptr);
     void* mmap_copy_on_write(const string_t& path, size_t* length = nullptr);
 
+    // Hint to the OS that the file will be read soon so its contents are
+    // brought into the page cache ahead of use. Best-effort; failures are ignored.
+    void file_readahead(const string_t& path);
+
     bool touch_file(const string_t& path);
     bool realpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
@@ -10,6 +10,7 @@
 #include "trace.h"
 
 #include <cassert>
+#include <climits>
 #include <dlfcn.h>
 #include <dirent.h>
 #include <pwd.h>
@@ -116,6 +117,28 @@ void* pal::mmap_copy_on_write(const string_t& path, size_t* length)
     return map_file(path, length, PROT_READ | PROT_WRITE, MAP_PRIVATE);
 }
 
+void pal::file_readahead(const pal::string_t& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return;
+
+#if defined(TARGET_OSX)
+    struct stat buf;
+    if (fstat(fd, &buf) == 0 && buf.st_size > 0)
+    {
+        struct radvisory advice;
+        advice.ra_offset = 0;
+        advice.ra_count = buf.st_size > INT_MAX ? INT_MAX : (int)buf.st_size;
+        (void)fcntl(fd, F_RDADVISE, &advice);
+    }
+#elif defined(POSIX_FADV_WILLNEED)
+    (void)posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+
+    close(fd);
+}
+
 bool pal::getcwd(pal::string_t* recv)
 {
     recv->clear();
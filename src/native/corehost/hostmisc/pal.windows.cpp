@@ -177,6 +177,35 @@ void* pal::mmap_copy_on_write(const string_t& path, size_t* length)
     return map_file(path, length, PAGE_WRITECOPY, FILE_MAP_READ | FILE_MAP_COPY);
 }
 
+void pal::file_readahead(const pal::string_t& path)
+{
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, 0, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) != 0 && fileSize.QuadPart > 0)
+    {
+        HANDLE map = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (map != NULL)
+        {
+            void* address = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+            if (address != NULL)
+            {
+                WIN32_MEMORY_RANGE_ENTRY range;
+                range.VirtualAddress = address;
+                range.NumberOfBytes = (SIZE_T)fileSize.QuadPart;
+                (void)PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+                UnmapViewOfFile(address);
+            }
+
+            CloseHandle(map);
+        }
+    }
+
+    CloseHandle(file);
+}
+
 bool pal::getcwd(pal::string_t* recv)
 {
     recv->clear();
@@ -0,0 +1,56 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_timing.h"
+#include "trace.h"
+
+#include <chrono>
+#include <cinttypes>
+
+namespace
+{
+    constexpr size_t phase_count = static_cast<size_t>(startup_timing::phase::count);
+
+    const pal::char_t* s_phase_names[phase_count] =
+    {
+        _X("hostfxr resolution"),
+        _X("deps resolution"),
+        _X("runtime load"),
+        _X("runtime initialization"),
+    };
+
+    std::chrono::steady_clock::time_point g_phase_start[phase_count];
+    uint64_t g_phase_duration_us[phase_count];
+}
+
+void startup_timing::begin(phase p)
+{
+    g_phase_start[static_cast<size_t>(p)] = std::chrono::steady_clock::now();
+}
+
+void startup_timing::end(phase p)
+{
+    size_t index = static_cast<size_t>(p);
+    g_phase_duration_us[index] += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - g_phase_start[index]).count());
+}
+
+uint64_t startup_timing::duration_us(phase p)
+{
+    return g_phase_duration_us[static_cast<size_t>(p)];
+}
+
+void startup_timing::report()
+{
+    if (!trace::is_enabled())
+        return;
+
+    for (size_t index = 0; index < phase_count; ++index)
+    {
+        if (g_phase_duration_us[index] != 0)
+        {
+            trace::verbose(_X("Startup phase [%s] took %" PRIu64 " us"), s_phase_names[index], g_phase_duration_us[index]);
+        }
+    }
+}
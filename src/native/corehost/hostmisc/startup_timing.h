@@ -0,0 +1,65 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef STARTUP_TIMING_H
+#define STARTUP_TIMING_H
+
+#include <cstdint>
+
+// Records wall-clock durations for the distinct phases of host startup.
+// Unlike the text tracing in trace.h, the recorded durations are structured
+// data: hostpolicy reports them to the app through host_runtime_contract so
+// startup regressions can be tracked without enabling COREHOST_TRACE.
+//
+// hostmisc is linked into each host component separately, so the recorded
+// state is per-module. All phases exposed through the contract are measured
+// in hostpolicy, which also owns the contract; phases measured in other
+// components (for example hostfxr resolution in the app host) are only
+// available through tracing.
+namespace startup_timing
+{
+    enum class phase
+    {
+        hostfxr_resolution,  // locating hostfxr next to the app or in an installation
+        deps_resolution,     // parsing .deps.json files and resolving probing paths
+        runtime_load,        // locating and loading the runtime library
+        runtime_initialize,  // initializing the runtime (coreclr_initialize)
+
+        count
+    };
+
+    // Mark the start/end of a phase. Phases do not nest; durations from
+    // repeated begin/end pairs for the same phase accumulate.
+    void begin(phase p);
+    void end(phase p);
+
+    // Duration of a phase in microseconds, 0 if the phase was not measured.
+    uint64_t duration_us(phase p);
+
+    // Write a verbose trace line for each measured phase.
+    void report();
+
+    // Measures a phase for the lifetime of the scope.
+    class scope_t
+    {
+    public:
+        scope_t(phase p)
+            : m_phase{ p }
+        {
+            begin(m_phase);
+        }
+
+        ~scope_t()
+        {
+            end(m_phase);
+        }
+
+        scope_t(const scope_t&) = delete;
+        scope_t& operator=(const scope_t&) = delete;
+
+    private:
+        phase m_phase;
+    };
+}
+
+#endif // STARTUP_TIMING_H
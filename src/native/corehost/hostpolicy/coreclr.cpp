@@ -5,6 +5,7 @@
 
 #include "coreclr.h"
 #include "coreclr_resolver.h"
+#include <startup_timing.h>
 #include <utils.h>
 #include <error_codes.h>
 
@@ -33,10 +34,13 @@ pal::hresult_t coreclr_t::create(
     const coreclr_property_bag_t &properties,
     std::unique_ptr<coreclr_t> &inst)
 {
-    if (!coreclr_bind(libcoreclr_path))
     {
-        trace::error(_X("Failed to bind to CoreCLR at '%s'"), libcoreclr_path.c_str());
-        return StatusCode::CoreClrBindFailure;
+        startup_timing::scope_t timing{ startup_timing::phase::runtime_load };
+        if (!coreclr_bind(libcoreclr_path))
+        {
+            trace::error(_X("Failed to bind to CoreCLR at '%s'"), libcoreclr_path.c_str());
+            return StatusCode::CoreClrBindFailure;
+        }
     }
 
     assert(coreclr_contract.coreclr_initialize != nullptr);
@@ -69,14 +73,17 @@ pal::hresult_t coreclr_t::create(
     }
 
     pal::hresult_t hr;
-    hr = coreclr_contract.coreclr_initialize(
-        exe_path,
-        app_domain_friendly_name,
-        propertyCount,
-        keys.data(),
-        values.data(),
-        &host_handle,
-        &domain_id);
+    {
+        startup_timing::scope_t timing{ startup_timing::phase::runtime_initialize };
+        hr = coreclr_contract.coreclr_initialize(
+            exe_path,
+            app_domain_friendly_name,
+            propertyCount,
+            keys.data(),
+            values.data(),
+            &host_handle,
+            &domain_id);
+    }
 
     if (coreclr_contract.coreclr_set_error_writer != nullptr)
     {
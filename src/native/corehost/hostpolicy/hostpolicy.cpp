@@ -12,6 +12,7 @@
 #include <utils.h>
 #include "coreclr.h"
 #include <error_codes.h>
+#include <startup_timing.h>
 #include "breadcrumbs.h"
 #include <host_startup_info.h>
 #include <corehost_context_contract.h>
@@ -86,6 +87,7 @@ namespace
             }
             else
             {
+                startup_timing::report();
                 rc = StatusCode::Success;
             }
 
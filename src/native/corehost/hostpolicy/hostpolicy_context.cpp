@@ -7,6 +7,7 @@
 
 #include "deps_resolver.h"
 #include <error_codes.h>
+#include <startup_timing.h>
 #include <trace.h>
 #include "bundle/runner.h"
 #include "bundle/file_entry.h"
@@ -133,6 +134,21 @@ namespace
 
         return -1;
     }
+
+    // get_startup_timing:
+    // Report the durations of the startup phases measured by hostpolicy.
+    //
+    // This function is an API exported to the runtime via the host_runtime_contract.
+    bool HOST_CONTRACT_CALLTYPE get_startup_timing(host_runtime_startup_timing* timing)
+    {
+        if (timing == nullptr || timing->size < sizeof(host_runtime_startup_timing))
+            return false;
+
+        timing->deps_resolution_us = startup_timing::duration_us(startup_timing::phase::deps_resolution);
+        timing->runtime_load_us = startup_timing::duration_us(startup_timing::phase::runtime_load);
+        timing->runtime_initialize_us = startup_timing::duration_us(startup_timing::phase::runtime_initialize);
+        return true;
+    }
 }
 
 bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_t &init)
@@ -155,6 +171,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
     host_path = hostpolicy_init.host_info.host_path;
     breadcrumbs_enabled = enable_breadcrumbs;
 
+    startup_timing::begin(startup_timing::phase::deps_resolution);
     deps_json_t::rid_resolution_options_t rid_resolution_options
     {
         should_read_rid_fallback_graph(hostpolicy_init),
@@ -203,6 +220,8 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         }
     }
 
+    startup_timing::end(startup_timing::phase::deps_resolution);
+
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::realpath(&clr_path))
     {
@@ -340,6 +359,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         }
 
         host_contract.get_runtime_property = &get_runtime_property;
+        host_contract.get_startup_timing = &get_startup_timing;
         pal::char_t buffer[STRING_LENGTH("0xffffffffffffffff")];
         pal::snwprintf(buffer, ARRAY_SIZE(buffer), _X("0x%zx"), (size_t)(&host_contract));
         if (!coreclr_properties.add(_STRINGIFY(HOST_PROPERTY_RUNTIME_CONTRACT), buffer))
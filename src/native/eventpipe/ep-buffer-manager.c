@@ -459,24 +459,41 @@ buffer_manager_allocate_buffer_for_thread (
 	EventPipeSequencePoint* sequence_point = NULL;
 	uint32_t sequence_number = 0;
 
-	// Pick a buffer size by multiplying the base buffer size by the number of buffers already allocated for this thread.
-	uint32_t size_multiplier = ep_thread_session_state_get_buffer_count_estimate(thread_session_state) + 1;
-	EP_ASSERT(size_multiplier > 0);
-
 	// Pick the base buffer size.  Checked builds have a smaller size to stress the allocate path more.
 #ifdef EP_CHECKED_BUILD
 	uint32_t base_buffer_size = 30 * 1024; // 30K
 #else
 	uint32_t base_buffer_size = 100 * 1024; // 100K
 #endif
-	uint32_t buffer_size = base_buffer_size * size_multiplier;
-	EP_ASSERT(buffer_size > 0);
-
-
-	buffer_size = EP_MAX (request_size, buffer_size);
 
 	// Don't allow the buffer size to exceed 1MB.
 	const uint32_t max_buffer_size = 1024 * 1024;
+
+	// Size the buffer to the rate at which this thread has been filling buffers rather than
+	// a fixed progression. A thread that filled its previous buffer quickly is in a burst and
+	// gets one twice the size so it returns here (and competes for the session budget) less
+	// often. A thread that took a long time to fill its previous buffer has gone quiet and
+	// restarts at the base size so it does not keep receiving max-size buffers it won't fill.
+	ep_timestamp_t current_timestamp = ep_perf_timestamp_get ();
+	ep_timestamp_t frequency = ep_perf_frequency_query ();
+	uint32_t last_buffer_size = ep_thread_session_state_get_last_buffer_size (thread_session_state);
+
+	uint32_t buffer_size = base_buffer_size;
+	if (last_buffer_size != 0) {
+		ep_timestamp_t fill_duration = current_timestamp - ep_thread_session_state_get_last_buffer_alloc_timestamp (thread_session_state);
+		if (fill_duration < frequency) {
+			// Filled the previous buffer in under a second - grow.
+			buffer_size = last_buffer_size * 2;
+		} else if (fill_duration < 10 * frequency) {
+			// Steady fill rate - keep the previous size.
+			buffer_size = last_buffer_size;
+		}
+	}
+
+	buffer_size = EP_CLAMP (base_buffer_size, buffer_size, max_buffer_size);
+	EP_ASSERT(buffer_size > 0);
+
+	buffer_size = EP_MAX (request_size, buffer_size);
 	buffer_size = EP_MIN (buffer_size, max_buffer_size);
 
 
@@ -496,6 +513,9 @@ buffer_manager_allocate_buffer_for_thread (
 	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
 	ep_raise_error_if_nok (new_buffer != NULL);
 
+	// Remember this allocation so the next one can estimate the fill rate.
+	ep_thread_session_state_set_last_buffer_alloc (thread_session_state, current_timestamp, buffer_size);
+
 	// Adding a buffer to the buffer list requires us to take the lock.
 	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
 		thread_buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
@@ -343,6 +343,8 @@ ep_thread_session_state_alloc (
 
 	instance->session = session;
 	instance->sequence_number = 1;
+	instance->last_buffer_alloc_timestamp = 0;
+	instance->last_buffer_size = 0;
 
 #ifdef EP_CHECKED_BUILD
 	instance->buffer_manager = buffer_manager;
@@ -357,17 +359,29 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+ep_timestamp_t
+ep_thread_session_state_get_last_buffer_alloc_timestamp (const EventPipeThreadSessionState *thread_session_state)
+{
+	EP_ASSERT (thread_session_state != NULL);
+	return thread_session_state->last_buffer_alloc_timestamp;
+}
+
 uint32_t
-ep_thread_session_state_get_buffer_count_estimate(const EventPipeThreadSessionState *thread_session_state)
-{
-	// this is specifically unprotected and allowed to be incorrect due to memory ordering
-	//
-	// buffer_list won't become NULL after getting this reference in the scope of this function.
-	//
-	// buffer_list is only set to NULL when the session is being freed
-	// when this code won't be called.
-	EventPipeBufferList *buffer_list = thread_session_state->buffer_list;
-	return buffer_list == NULL ? 0 : buffer_list->buffer_count;
+ep_thread_session_state_get_last_buffer_size (const EventPipeThreadSessionState *thread_session_state)
+{
+	EP_ASSERT (thread_session_state != NULL);
+	return thread_session_state->last_buffer_size;
+}
+
+void
+ep_thread_session_state_set_last_buffer_alloc (
+	EventPipeThreadSessionState *thread_session_state,
+	ep_timestamp_t alloc_timestamp,
+	uint32_t buffer_size)
+{
+	EP_ASSERT (thread_session_state != NULL);
+	thread_session_state->last_buffer_alloc_timestamp = alloc_timestamp;
+	thread_session_state->last_buffer_size = buffer_size;
 }
 
 void
@@ -260,9 +260,6 @@ struct _EventPipeThreadSessionState_Internal {
 	// a buffer for this session. It is set back to null when
 	// event writing is suspended during session disable.
 	// protected by the buffer manager lock.
-	// This field can be read outside the lock when
-	// the buffer allocation logic is estimating how many
-	// buffers a given thread has used (see: ep_thread_session_state_get_buffer_count_estimate and its uses).
 	EventPipeBufferList *buffer_list;
 #ifdef EP_CHECKED_BUILD
 	// protected by the buffer manager lock.
@@ -288,6 +285,14 @@ struct _EventPipeThreadSessionState_Internal {
 	// buffers are later read and there are fewer than X events timestamped
 	// prior to the sequence point we can be certain the others were dropped.
 	volatile uint32_t sequence_number;
+	// Timestamp of the most recent buffer allocation for this thread and the
+	// size of that buffer. Together they estimate how quickly this thread fills
+	// buffers, which the buffer manager uses to size successor buffers
+	// (see: buffer_manager_allocate_buffer_for_thread).
+	// Only accessed by the owning thread while it allocates a buffer, so no lock
+	// is required.
+	ep_timestamp_t last_buffer_alloc_timestamp;
+	uint32_t last_buffer_size;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_THREAD_GETTER_SETTER)
@@ -311,8 +316,20 @@ ep_thread_session_state_free (EventPipeThreadSessionState *thread_session_state)
 EventPipeThread *
 ep_thread_session_state_get_thread (const EventPipeThreadSessionState *thread_session_state);
 
+// _Requires_ the owning thread
+ep_timestamp_t
+ep_thread_session_state_get_last_buffer_alloc_timestamp (const EventPipeThreadSessionState *thread_session_state);
+
+// _Requires_ the owning thread
 uint32_t
-ep_thread_session_state_get_buffer_count_estimate(const EventPipeThreadSessionState *thread_session_state);
+ep_thread_session_state_get_last_buffer_size (const EventPipeThreadSessionState *thread_session_state);
+
+// _Requires_ the owning thread
+void
+ep_thread_session_state_set_last_buffer_alloc (
+	EventPipeThreadSessionState *thread_session_state,
+	ep_timestamp_t alloc_timestamp,
+	uint32_t buffer_size);
 
 // _Requires_lock_held (thread)
 EventPipeBuffer *
@@ -15,6 +15,44 @@
 #pragma clang diagnostic ignored "-Wsign-conversion"
 #endif
 
+/*
+Case converts the longest run of ASCII code units starting at idx with plain
+arithmetic, returning the index of the first code unit it could not handle
+(the first non-ASCII unit, or limit). ASCII has the same simple case mappings
+in every casing this file performs except Turkish, so the ICU-based loops
+below use these helpers to skip ahead in bulk; the branch-free scalar loops
+are simple enough for the compiler to vectorize.
+*/
+static int32_t ChangeCaseAsciiUpper(const UChar* lpSrc, UChar* lpDst, int32_t idx, int32_t limit)
+{
+    while (idx < limit)
+    {
+        UChar c = lpSrc[idx];
+        if (c >= 0x80)
+        {
+            break;
+        }
+        lpDst[idx] = (UChar)((c >= 'a' && c <= 'z') ? (c - 0x20) : c);
+        idx++;
+    }
+    return idx;
+}
+
+static int32_t ChangeCaseAsciiLower(const UChar* lpSrc, UChar* lpDst, int32_t idx, int32_t limit)
+{
+    while (idx < limit)
+    {
+        UChar c = lpSrc[idx];
+        if (c >= 0x80)
+        {
+            break;
+        }
+        lpDst[idx] = (UChar)((c >= 'A' && c <= 'Z') ? (c + 0x20) : c);
+        idx++;
+    }
+    return idx;
+}
+
 /*
 Function:
 ChangeCase
@@ -39,11 +77,17 @@ void GlobalizationNative_ChangeCase(
     (void)isError; // only used for assert
     int32_t srcIdx = 0, dstIdx = 0;
     UChar32 srcCodepoint, dstCodepoint;
+    int32_t asciiLimit = cwSrcLength < cwDstLength ? cwSrcLength : cwDstLength;
 
     if (bToUpper)
     {
         while (srcIdx < cwSrcLength)
         {
+            srcIdx = dstIdx = ChangeCaseAsciiUpper(lpSrc, lpDst, srcIdx, asciiLimit);
+            if (srcIdx >= cwSrcLength)
+            {
+                break;
+            }
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_toupper(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -54,6 +98,11 @@ void GlobalizationNative_ChangeCase(
     {
         while (srcIdx < cwSrcLength)
         {
+            srcIdx = dstIdx = ChangeCaseAsciiLower(lpSrc, lpDst, srcIdx, asciiLimit);
+            if (srcIdx >= cwSrcLength)
+            {
+                break;
+            }
             U16_NEXT(lpSrc, srcIdx, cwSrcLength, srcCodepoint);
             dstCodepoint = u_tolower(srcCodepoint);
             U16_APPEND(lpDst, dstIdx, cwDstLength, dstCodepoint, isError);
@@ -79,11 +128,19 @@ void GlobalizationNative_ChangeCaseInvariant(
     (void)isError; // only used for assert
     int32_t srcIdx = 0, dstIdx = 0;
     UChar32 srcCodepoint, dstCodepoint;
+    int32_t asciiLimit = cwSrcLength < cwDstLength ? cwSrcLength : cwDstLength;
 
     if (bToUpper)
     {
         while (srcIdx < cwSrcLength)
         {
+            // The characters the invariant special cases below differ on are not ASCII,
+            // so the ASCII bulk helper applies here as well.
+            srcIdx = dstIdx = ChangeCaseAsciiUpper(lpSrc, lpDst, srcIdx, asciiLimit);
+            if (srcIdx >= cwSrcLength)
+            {
+                break;
+            }
             // On Windows with InvariantCulture, the LATIN SMALL LETTER DOTLESS I (U+0131)
             // capitalizes to itself, whereas with ICU it capitalizes to LATIN CAPITAL LETTER I (U+0049).
             // We special case it to match the Windows invariant behavior.
@@ -97,6 +154,11 @@ void GlobalizationNative_ChangeCaseInvariant(
     {
         while (srcIdx < cwSrcLength)
         {
+            srcIdx = dstIdx = ChangeCaseAsciiLower(lpSrc, lpDst, srcIdx, asciiLimit);
+            if (srcIdx >= cwSrcLength)
+            {
+                break;
+            }
             // On Windows with InvariantCulture, the LATIN CAPITAL LETTER I WITH DOT ABOVE (U+0130)
             // lower cases to itself, whereas with ICU it lower cases to LATIN SMALL LETTER I (U+0069).
             // We special case it to match the Windows invariant behavior.
@@ -904,6 +904,23 @@ CompareString
 int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
+    // Identical strings collate equal under every collator and option set, and
+    // workloads that re-validate sorted data (index maintenance, cache lookups)
+    // hit that case for the overwhelming majority of their comparisons. Answer
+    // it with a plain memory compare instead of paying for ICU's collation
+    // element iteration; memcmp early-outs at the first difference, so the
+    // cost on the miss path is a short shared prefix scan.
+    //
+    // A full ordering fast path for ASCII inputs is deliberately not taken:
+    // even at primary strength, culture-aware ordering of ASCII is not ordinal
+    // ('a' sorts before 'B'), and locales may tailor ASCII characters, so
+    // anything short of equality has to go through the collator.
+    if (lpStr1 != NULL && lpStr2 != NULL && cwStr1Length == cwStr2Length && cwStr1Length >= 0 &&
+        memcmp(lpStr1, lpStr2, (size_t)cwStr1Length * sizeof(UChar)) == 0)
+    {
+        return UCOL_EQUAL;
+    }
+
     UCollationResult result = UCOL_EQUAL;
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
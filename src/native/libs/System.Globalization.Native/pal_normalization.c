@@ -4,10 +4,29 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "pal_icushim_internal.h"
 #include "pal_normalization.h"
 
+/*
+Returns true when the string consists entirely of ASCII code units. ASCII strings are
+normalized in all four normalization forms, so the entry points below can answer for
+them without going through ICU; the scalar loop is simple enough for the compiler to
+vectorize.
+*/
+static bool IsAsciiOnly(const UChar* lpStr, int32_t cwStrLength)
+{
+    for (int32_t i = 0; i < cwStrLength; i++)
+    {
+        if (lpStr[i] >= 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 static const UNormalizer2* GetNormalizerForForm(NormalizationForm normalizationForm, UErrorCode* pErrorCode)
 {
     switch (normalizationForm)
@@ -44,6 +63,17 @@ int32_t GlobalizationNative_IsNormalized(
 {
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
+
+    if (U_FAILURE(err))
+    {
+        return -1;
+    }
+
+    if (IsAsciiOnly(lpStr, cwStrLength))
+    {
+        return 1;
+    }
+
     UBool isNormalized = unorm2_isNormalized(pNormalizer, lpStr, cwStrLength, &err);
 
     if (U_SUCCESS(err))
@@ -73,6 +103,25 @@ int32_t GlobalizationNative_NormalizeString(
 {
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
+
+    if (U_FAILURE(err))
+    {
+        return 0;
+    }
+
+    // ASCII strings are already normalized in every supported form and can be copied
+    // as is. Undersized destination buffers still go through ICU so that the buffer
+    // overflow contract (returning the required length) is kept in one place.
+    if (cwDstLength >= cwSrcLength && IsAsciiOnly(lpSrc, cwSrcLength))
+    {
+        memcpy(lpDst, lpSrc, (size_t)cwSrcLength * sizeof(UChar));
+        if (cwDstLength > cwSrcLength)
+        {
+            lpDst[cwSrcLength] = 0;
+        }
+        return cwSrcLength;
+    }
+
     int32_t normalizedLen = unorm2_normalize(pNormalizer, lpSrc, cwSrcLength, lpDst, cwDstLength, &err);
 
     return (U_SUCCESS(err) || (err == U_BUFFER_OVERFLOW_ERROR)) ? normalizedLen : 0;
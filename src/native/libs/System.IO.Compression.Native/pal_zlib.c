@@ -3,8 +3,13 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 #include "pal_zlib.h"
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
 #ifdef INTERNAL_ZLIB
     #ifdef  _WIN32
         #define c_static_assert(e) static_assert((e),"")
@@ -194,3 +199,262 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+// Size of the independent input blocks handed to the parallel deflate worker
+// threads. Each block is compressed with its own deflate state, so larger
+// blocks improve the compression ratio (no history is shared across blocks)
+// while smaller blocks improve load balancing.
+#define PARALLEL_DEFLATE_BLOCK_SIZE ((int64_t)(1024 * 1024))
+#define PARALLEL_DEFLATE_MAX_WORKERS 64
+
+typedef struct
+{
+    uint8_t* source;
+    int64_t sourceLength;
+    int32_t blockCount;
+    int32_t workerIndex;
+    int32_t workerCount;
+    int32_t level;
+    int32_t finish;
+    uint8_t** blockOutputs;
+    uint32_t* blockLengths;
+    int32_t* blockResults;
+} ParallelDeflateWorkerState;
+
+static void ParallelDeflateWorker(ParallelDeflateWorkerState* state)
+{
+    for (int32_t block = state->workerIndex; block < state->blockCount; block += state->workerCount)
+    {
+        int64_t offset = block * PARALLEL_DEFLATE_BLOCK_SIZE;
+        int64_t remaining = state->sourceLength - offset;
+        uint32_t length = (uint32_t)(remaining < PARALLEL_DEFLATE_BLOCK_SIZE ? remaining : PARALLEL_DEFLATE_BLOCK_SIZE);
+        int32_t isLastBlock = block == state->blockCount - 1;
+
+        z_stream zStream;
+        memset(&zStream, 0, sizeof(zStream));
+        int32_t result = deflateInit2(&zStream, state->level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+        if (result != Z_OK)
+        {
+            state->blockResults[block] = result;
+            continue;
+        }
+
+        uLong bound = deflateBound(&zStream, length) + 16;
+        uint8_t* output = (uint8_t*)malloc(bound);
+        if (output == NULL)
+        {
+            deflateEnd(&zStream);
+            state->blockResults[block] = Z_MEM_ERROR;
+            continue;
+        }
+
+        zStream.next_in = (Bytef*)(state->source + offset);
+        zStream.avail_in = length;
+        zStream.next_out = output;
+        zStream.avail_out = (uInt)bound;
+
+        // A sync flush ends each non-final block on a byte boundary with an
+        // empty stored block, so the per-block outputs concatenate into a
+        // single valid deflate stream; only the very last block of a
+        // finishing call emits the final-block bit.
+        int flush = (isLastBlock && state->finish) ? Z_FINISH : Z_SYNC_FLUSH;
+        result = deflate(&zStream, flush);
+        if ((flush == Z_FINISH && result == Z_STREAM_END) ||
+            (flush == Z_SYNC_FLUSH && result == Z_OK && zStream.avail_in == 0))
+        {
+            state->blockOutputs[block] = output;
+            state->blockLengths[block] = (uint32_t)(bound - zStream.avail_out);
+            state->blockResults[block] = Z_OK;
+        }
+        else
+        {
+            free(output);
+            state->blockResults[block] = result < 0 ? result : Z_STREAM_ERROR;
+        }
+
+        deflateEnd(&zStream);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI ParallelDeflateWorkerThread(LPVOID arg)
+{
+    ParallelDeflateWorker((ParallelDeflateWorkerState*)arg);
+    return 0;
+}
+#else
+static void* ParallelDeflateWorkerThread(void* arg)
+{
+    ParallelDeflateWorker((ParallelDeflateWorkerState*)arg);
+    return NULL;
+}
+#endif
+
+int32_t CompressionNative_DeflateParallel(
+    uint8_t* source,
+    int64_t sourceLength,
+    uint8_t* destination,
+    int64_t* destinationLength,
+    int32_t finish,
+    int32_t level,
+    int32_t threadCount)
+{
+    assert(destination != NULL);
+    assert(destinationLength != NULL);
+    assert(source != NULL || sourceLength == 0);
+
+    if (sourceLength < 0 || *destinationLength < 0)
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    if (sourceLength == 0 && !finish)
+    {
+        *destinationLength = 0;
+        return PAL_Z_OK;
+    }
+
+    // A finishing call with no input still compresses one empty block so the
+    // stream gets its final-block marker.
+    int32_t blockCount = (int32_t)((sourceLength + PARALLEL_DEFLATE_BLOCK_SIZE - 1) / PARALLEL_DEFLATE_BLOCK_SIZE);
+    if (blockCount == 0)
+    {
+        blockCount = 1;
+    }
+
+    int32_t workerCount = threadCount < 1 ? 1 : threadCount;
+    if (workerCount > PARALLEL_DEFLATE_MAX_WORKERS)
+    {
+        workerCount = PARALLEL_DEFLATE_MAX_WORKERS;
+    }
+    if (workerCount > blockCount)
+    {
+        workerCount = blockCount;
+    }
+
+    int32_t result = PAL_Z_MEMERROR;
+    uint8_t** blockOutputs = (uint8_t**)calloc((size_t)blockCount, sizeof(uint8_t*));
+    uint32_t* blockLengths = (uint32_t*)calloc((size_t)blockCount, sizeof(uint32_t));
+    int32_t* blockResults = (int32_t*)calloc((size_t)blockCount, sizeof(int32_t));
+    ParallelDeflateWorkerState* workers =
+        (ParallelDeflateWorkerState*)calloc((size_t)workerCount, sizeof(ParallelDeflateWorkerState));
+    if (blockOutputs == NULL || blockLengths == NULL || blockResults == NULL || workers == NULL)
+    {
+        goto done;
+    }
+
+    for (int32_t i = 0; i < workerCount; i++)
+    {
+        workers[i].source = source;
+        workers[i].sourceLength = sourceLength;
+        workers[i].blockCount = blockCount;
+        workers[i].workerIndex = i;
+        workers[i].workerCount = workerCount;
+        workers[i].level = level;
+        workers[i].finish = finish;
+        workers[i].blockOutputs = blockOutputs;
+        workers[i].blockLengths = blockLengths;
+        workers[i].blockResults = blockResults;
+    }
+
+    // Workers 1..N-1 run on their own threads; worker 0 runs on the calling
+    // thread. A worker whose thread cannot be created just runs inline.
+    {
+#ifdef _WIN32
+        HANDLE threads[PARALLEL_DEFLATE_MAX_WORKERS];
+        int32_t started = 0;
+        for (int32_t i = 1; i < workerCount; i++)
+        {
+            threads[started] = CreateThread(NULL, 0, ParallelDeflateWorkerThread, &workers[i], 0, NULL);
+            if (threads[started] != NULL)
+            {
+                started++;
+            }
+            else
+            {
+                ParallelDeflateWorker(&workers[i]);
+            }
+        }
+
+        ParallelDeflateWorker(&workers[0]);
+
+        for (int32_t i = 0; i < started; i++)
+        {
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        }
+#else
+        pthread_t threads[PARALLEL_DEFLATE_MAX_WORKERS];
+        int32_t started = 0;
+        for (int32_t i = 1; i < workerCount; i++)
+        {
+            if (pthread_create(&threads[started], NULL, ParallelDeflateWorkerThread, &workers[i]) == 0)
+            {
+                started++;
+            }
+            else
+            {
+                ParallelDeflateWorker(&workers[i]);
+            }
+        }
+
+        ParallelDeflateWorker(&workers[0]);
+
+        for (int32_t i = 0; i < started; i++)
+        {
+            pthread_join(threads[i], NULL);
+        }
+#endif
+    }
+
+    result = finish ? PAL_Z_STREAMEND : PAL_Z_OK;
+
+    int64_t totalLength = 0;
+    for (int32_t block = 0; block < blockCount; block++)
+    {
+        if (blockResults[block] != Z_OK)
+        {
+            result = blockResults[block];
+            break;
+        }
+        totalLength += blockLengths[block];
+    }
+
+    if (result == PAL_Z_OK || result == PAL_Z_STREAMEND)
+    {
+        if (totalLength > *destinationLength)
+        {
+            result = PAL_Z_BUFERROR;
+        }
+        else
+        {
+            uint8_t* next = destination;
+            for (int32_t block = 0; block < blockCount; block++)
+            {
+                memcpy(next, blockOutputs[block], blockLengths[block]);
+                next += blockLengths[block];
+            }
+            *destinationLength = totalLength;
+        }
+    }
+
+done:
+    if (result != PAL_Z_OK && result != PAL_Z_STREAMEND)
+    {
+        *destinationLength = 0;
+    }
+
+    if (blockOutputs != NULL)
+    {
+        for (int32_t block = 0; block < blockCount; block++)
+        {
+            free(blockOutputs[block]);
+        }
+    }
+
+    free(blockOutputs);
+    free(blockLengths);
+    free(blockResults);
+    free(workers);
+    return result;
+}
@@ -102,6 +102,21 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateEnd(PAL_ZStream* stream);
 
+/*
+Deflates (compresses) sourceLength bytes from source into destination as a
+single one-shot operation, splitting the input into independent blocks that
+are compressed on up to threadCount threads. The per-block outputs are
+byte-aligned with sync flushes so their concatenation forms a single valid
+raw deflate stream; when finish is nonzero the last block carries the
+final-block marker. On input *destinationLength is the destination capacity;
+on success it is updated to the number of bytes written.
+
+Returns PAL_Z_STREAMEND when finish is nonzero, PAL_Z_OK otherwise, or an
+error number on failure (PAL_Z_BUFERROR if the destination is too small).
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateParallel(
+    uint8_t* source, int64_t sourceLength, uint8_t* destination, int64_t* destinationLength, int32_t finish, int32_t level, int32_t threadCount);
+
 /*
 Initializes the PAL_ZStream so the Inflate function can be invoked on it.
 
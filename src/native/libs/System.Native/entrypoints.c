@@ -66,6 +66,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirBatch)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -160,9 +161,11 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetSendTimeout)
     DllImportEntry(SystemNative_Receive)
     DllImportEntry(SystemNative_ReceiveMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
     DllImportEntry(SystemNative_ReceiveSocketError)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_SendMessages)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -190,6 +193,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_Splice)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
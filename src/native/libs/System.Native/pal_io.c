@@ -538,6 +538,85 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     return 0;
 }
 
+// Fills a caller-supplied buffer with a batch of directory entries so large
+// directories are not paying one native transition per entry. The front of
+// the buffer is filled with an array of DirectoryEntry records whose Name
+// pointers reference null-terminated copies of the entry names packed at the
+// back of the same buffer, so the names remain valid after subsequent
+// readdir/closedir calls.
+//
+// Returns 0 on success with *count set to the number of entries read, where 0
+// means end-of-stream; otherwise, returns the positive errno reported by
+// readdir. An error encountered after some entries were already accumulated
+// is deferred: the accumulated batch is returned and the error surfaces on
+// the next call.
+int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, int32_t* count)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL);
+    assert(count != NULL);
+    assert(((uintptr_t)buffer % sizeof(void*)) == 0);
+
+    DirectoryEntry* entries = (DirectoryEntry*)(void*)buffer;
+    uint8_t* namesEnd = buffer + bufferSize;
+    int32_t numEntries = 0;
+
+    while (true)
+    {
+        uint8_t* entriesEnd = (uint8_t*)(void*)(entries + numEntries + 1);
+        if (entriesEnd >= namesEnd)
+        {
+            break;
+        }
+
+        // Remember the stream position so an entry that does not fit in the
+        // remaining buffer space can be pushed back for the next batch.
+        long position = telldir(dir);
+
+        errno = 0;
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            if (errno != 0 && numEntries == 0)
+            {
+                assert_err(errno == EBADF, "Invalid directory stream descriptor dir", errno);
+                *count = 0;
+                return errno;
+            }
+            break;
+        }
+
+        DirectoryEntry converted;
+        ConvertDirent(entry, &converted);
+
+        size_t nameLength = converted.NameLength >= 0 ? (size_t)converted.NameLength : strlen(entry->d_name);
+        uint8_t* name = namesEnd - (nameLength + 1);
+        if (name < entriesEnd)
+        {
+            seekdir(dir, position);
+            if (numEntries == 0)
+            {
+                // Not even one entry fits; report it so the caller can retry
+                // with a larger buffer instead of mistaking this for
+                // end-of-stream.
+                *count = 0;
+                return ERANGE;
+            }
+            break;
+        }
+
+        memcpy(name, entry->d_name, nameLength + 1);
+        entries[numEntries].Name = (const char*)name;
+        entries[numEntries].NameLength = (int32_t)nameLength;
+        entries[numEntries].InodeType = converted.InodeType;
+        namesEnd = name;
+        numEntries++;
+    }
+
+    *count = numEntries;
+    return 0;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
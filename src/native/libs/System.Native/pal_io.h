@@ -395,6 +395,15 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Retrieves a batch of dirents from the directory stream pointed to by dir. The buffer is filled with an
+ * array of DirectoryEntry records at the front whose names are copied to the back of the same buffer.
+ *
+ * Returns 0 when data is retrieved with count set to the number of entries (0 meaning end-of-stream);
+ * returns an error code on failure, including ERANGE when the buffer cannot hold a single entry.
+ */
+PALEXPORT int32_t SystemNative_ReadDirBatch(DIR* dir, uint8_t* buffer, int32_t bufferSize, int32_t* count);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -16,6 +16,12 @@
 #include <sys/time.h>
 #if HAVE_EPOLL
 #include <sys/epoll.h>
+#if HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 #elif HAVE_KQUEUE
 #include <sys/types.h>
 #include <sys/event.h>
@@ -1567,6 +1573,162 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// Bounds the stack space used for the kernel message array in the batched
+// send/receive entry points; callers with larger batches complete in
+// multiple calls.
+#define MESSAGE_BATCH_LIMIT 64
+
+static int32_t ValidateMessageBatch(MessageHeader* messageHeaders, int64_t* transferred, int32_t* count)
+{
+    if (messageHeaders == NULL || transferred == NULL || count == NULL || *count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    for (int32_t i = 0; i < *count; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 ||
+            messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_ReceiveMessages(intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t* count, int32_t flags)
+{
+    int32_t error = ValidateMessageBatch(messageHeaders, received, count);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+#if HAVE_RECVMMSG
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr messages[MESSAGE_BATCH_LIMIT];
+    unsigned int messageCount = (unsigned int)Min(*count, MESSAGE_BATCH_LIMIT);
+    for (unsigned int i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&messages[i].msg_hdr, &messageHeaders[i], fd);
+        messages[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = recvmmsg(fd, messages, messageCount, socketFlags, NULL)) < 0 && errno == EINTR);
+    if (res < 1)
+    {
+        *count = 0;
+        return res == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        struct msghdr* header = &messages[i].msg_hdr;
+        MessageHeader* messageHeader = &messageHeaders[i];
+
+        assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+        messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+        assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+        messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+        messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+        received[i] = messages[i].msg_len;
+    }
+
+    *count = res;
+    return Error_SUCCESS;
+#else
+    // No batched receive syscall on this platform; receive one message at a
+    // time. As with recvmmsg, only the first message may block, so callers
+    // are expected to use non-blocking sockets for larger batches.
+    int32_t completed = 0;
+    while (completed < *count)
+    {
+        error = SystemNative_ReceiveMessage(socket, &messageHeaders[completed], flags, &received[completed]);
+        if (error != Error_SUCCESS)
+        {
+            break;
+        }
+        completed++;
+    }
+
+    *count = completed;
+
+    // Mirror recvmmsg: an error is surfaced only when no message was received.
+    return completed > 0 ? Error_SUCCESS : error;
+#endif
+}
+
+int32_t SystemNative_SendMessages(intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t* count, int32_t flags)
+{
+    int32_t error = ValidateMessageBatch(messageHeaders, sent, count);
+    if (error != Error_SUCCESS)
+    {
+        return error;
+    }
+
+#if HAVE_SENDMMSG
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr messages[MESSAGE_BATCH_LIMIT];
+    unsigned int messageCount = (unsigned int)Min(*count, MESSAGE_BATCH_LIMIT);
+    for (unsigned int i = 0; i < messageCount; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&messages[i].msg_hdr, &messageHeaders[i], fd);
+        messages[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, messages, messageCount, socketFlags)) < 0 && errno == EINTR);
+    if (res < 1)
+    {
+        *count = 0;
+        return res == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int i = 0; i < res; i++)
+    {
+        sent[i] = messages[i].msg_len;
+    }
+
+    *count = res;
+    return Error_SUCCESS;
+#else
+    // No batched send syscall on this platform; send one message at a time.
+    int32_t completed = 0;
+    while (completed < *count)
+    {
+        error = SystemNative_SendMessage(socket, &messageHeaders[completed], flags, &sent[completed]);
+        if (error != Error_SUCCESS)
+        {
+            break;
+        }
+        completed++;
+    }
+
+    *count = completed;
+
+    // Mirror sendmmsg: an error is surfaced only when no message was sent.
+    return completed > 0 ? Error_SUCCESS : error;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -2782,10 +2944,562 @@ static uint32_t GetEPollEvents(SocketEvents events)
            (((events & SocketEvents_SA_ERROR) != 0) ? EPOLLERR : 0);
 }
 
+#if HAVE_IO_URING
+
+// Optional io_uring backend for the socket event port. The managed
+// SocketAsyncEngine is readiness-based, so the backend uses multishot poll:
+// a single IORING_OP_POLL_ADD submission per registration posts a completion
+// every time the socket becomes ready (edge-triggered, like EPOLLET), and the
+// engine thread drains completions directly from the shared completion ring,
+// entering the kernel only when the ring is empty. Compared to epoll this
+// removes the epoll_wait syscall whenever completions are already pending.
+//
+// The backend is opt-in via DOTNET_SYSTEM_NET_SOCKETS_IOURING=1 and is used
+// only when a runtime probe shows the kernel supports multishot poll
+// (Linux 5.13+); otherwise port creation quietly falls back to epoll.
+
+typedef struct IoUringRegistration
+{
+    struct IoUringRegistration* next; // hash chain or defunct list; protected by the port lock
+    uintptr_t data;                   // surfaced as SocketEvent.Data
+    int32_t socket;
+    uint32_t events;                  // requested event mask, in EPOLL* terms
+    int32_t armed;                    // multishot poll submitted and not yet terminated
+} IoUringRegistration;
+
+#define IO_URING_SQ_ENTRIES 128
+#define IO_URING_CQ_ENTRIES 4096
+#define IO_URING_REG_BUCKETS 256
+
+// user_data for control submissions (poll removals and the support probe).
+// Registration completions carry the (aligned) node pointer, so an odd value
+// can never collide with one.
+#define IO_URING_CONTROL_UDATA 1
+
+typedef struct IoUringPort
+{
+    struct IoUringPort* next; // global port list, protected by s_ioUringPortsLock
+    int32_t ringFd;
+    pthread_mutex_t lock; // guards the submission queue and the registration state
+
+    uint8_t* rings;
+    size_t ringsSize;
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+
+    uint32_t* sqTail;
+    uint32_t sqMask;
+    uint32_t* sqArray;
+
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqMask;
+    struct io_uring_cqe* cqes;
+
+    IoUringRegistration* registrations[IO_URING_REG_BUCKETS];
+
+    // Registrations whose cancelation has been submitted. They are freed when
+    // their terminal completion is consumed, or when the port is closed.
+    IoUringRegistration* defunctRegistrations;
+} IoUringPort;
+
+static IoUringPort* s_ioUringPorts = NULL;
+static pthread_mutex_t s_ioUringPortsLock = PTHREAD_MUTEX_INITIALIZER;
+
+static int IoUringSetup(uint32_t entries, struct io_uring_params* params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int IoUringEnter(int ringFd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static uint32_t IoUringPollEvents(uint32_t events)
+{
+    // io_uring consumes the poll mask in little-endian order. On Linux the
+    // EPOLL* constants match the POLL* values the mask is built from.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    events = __builtin_bswap32(events);
+#endif
+    return events;
+}
+
+static int32_t IoUringMapPort(IoUringPort* port)
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = IO_URING_CQ_ENTRIES;
+
+    int ringFd = IoUringSetup(IO_URING_SQ_ENTRIES, &params);
+    if (ringFd == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    // A single mapping for both rings keeps the bookkeeping simple and a
+    // never-dropped completion queue lets the drain loop trust the ring
+    // contents. Both predate multishot poll, so requiring them loses nothing.
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0 || (params.features & IORING_FEAT_NODROP) == 0)
+    {
+        close(ringFd);
+        return Error_ENOSYS;
+    }
+
+    size_t sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    size_t cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    size_t ringsSize = sqRingSize > cqRingSize ? sqRingSize : cqRingSize;
+
+    uint8_t* rings =
+        (uint8_t*)mmap(NULL, ringsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+    if (rings == MAP_FAILED)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        close(ringFd);
+        return error;
+    }
+
+    size_t sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    struct io_uring_sqe* sqes = (struct io_uring_sqe*)mmap(
+        NULL, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        munmap(rings, ringsSize);
+        close(ringFd);
+        return error;
+    }
+
+    port->ringFd = ringFd;
+    port->rings = rings;
+    port->ringsSize = ringsSize;
+    port->sqes = sqes;
+    port->sqesSize = sqesSize;
+    port->sqTail = (uint32_t*)(rings + params.sq_off.tail);
+    port->sqMask = *(uint32_t*)(rings + params.sq_off.ring_mask);
+    port->sqArray = (uint32_t*)(rings + params.sq_off.array);
+    port->cqHead = (uint32_t*)(rings + params.cq_off.head);
+    port->cqTail = (uint32_t*)(rings + params.cq_off.tail);
+    port->cqMask = *(uint32_t*)(rings + params.cq_off.ring_mask);
+    port->cqes = (struct io_uring_cqe*)(rings + params.cq_off.cqes);
+    return Error_SUCCESS;
+}
+
+static void IoUringUnmapPort(IoUringPort* port)
+{
+    munmap(port->sqes, port->sqesSize);
+    munmap(port->rings, port->ringsSize);
+    close(port->ringFd);
+}
+
+static struct io_uring_sqe* IoUringNextSqe(IoUringPort* port)
+{
+    // The submission queue is flushed synchronously under the port lock, so
+    // there is always room for the next entry.
+    uint32_t tail = *port->sqTail;
+    struct io_uring_sqe* sqe = &port->sqes[tail & port->sqMask];
+    memset(sqe, 0, sizeof(*sqe));
+    port->sqArray[tail & port->sqMask] = tail & port->sqMask;
+    __atomic_store_n(port->sqTail, tail + 1, __ATOMIC_RELEASE);
+    return sqe;
+}
+
+static int32_t IoUringSubmit(IoUringPort* port, uint32_t count)
+{
+    int err;
+    while ((err = IoUringEnter(port->ringFd, count, 0, 0)) == -1 && errno == EINTR);
+    return err == -1 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+}
+
+static void IoUringPreparePollAdd(IoUringPort* port, IoUringRegistration* registration)
+{
+    struct io_uring_sqe* sqe = IoUringNextSqe(port);
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = registration->socket;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = IoUringPollEvents(registration->events);
+    sqe->user_data = (uint64_t)(uintptr_t)registration;
+    registration->armed = 1;
+}
+
+static void IoUringPreparePollRemove(IoUringPort* port, IoUringRegistration* registration)
+{
+    struct io_uring_sqe* sqe = IoUringNextSqe(port);
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)registration;
+    sqe->user_data = IO_URING_CONTROL_UDATA;
+}
+
+static int32_t IoUringSupportsMultishotPoll(void)
+{
+    IoUringPort port;
+    memset(&port, 0, sizeof(port));
+    if (IoUringMapPort(&port) != Error_SUCCESS)
+    {
+        return 0;
+    }
+
+    // An unsignaled eventfd is immediately writable, so a multishot poll for
+    // write readiness completes at once. Kernels without multishot support
+    // fail the completion with EINVAL instead.
+    int32_t supported = 0;
+    int eventFd = eventfd(0, EFD_CLOEXEC);
+    if (eventFd != -1)
+    {
+        struct io_uring_sqe* sqe = IoUringNextSqe(&port);
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = eventFd;
+        sqe->len = IORING_POLL_ADD_MULTI;
+        sqe->poll32_events = IoUringPollEvents(EPOLLOUT);
+        sqe->user_data = IO_URING_CONTROL_UDATA;
+
+        int err;
+        while ((err = IoUringEnter(port.ringFd, 1, 1, IORING_ENTER_GETEVENTS)) == -1 && errno == EINTR);
+        if (err != -1)
+        {
+            uint32_t head = *port.cqHead;
+            if (head != __atomic_load_n(port.cqTail, __ATOMIC_ACQUIRE))
+            {
+                supported = port.cqes[head & port.cqMask].res >= 0;
+            }
+        }
+
+        close(eventFd);
+    }
+
+    IoUringUnmapPort(&port);
+    return supported;
+}
+
+static int32_t IoUringEnabled(void)
+{
+    static int32_t enabled = -1;
+    if (enabled == -1)
+    {
+        // Benign race: concurrent initialization computes the same value.
+        const char* value = getenv("DOTNET_SYSTEM_NET_SOCKETS_IOURING");
+        enabled = value != NULL && strcmp(value, "1") == 0 && IoUringSupportsMultishotPoll();
+    }
+
+    return enabled;
+}
+
+static IoUringPort* IoUringFindPort(int32_t port)
+{
+    pthread_mutex_lock(&s_ioUringPortsLock);
+    IoUringPort* ioUringPort = s_ioUringPorts;
+    while (ioUringPort != NULL && ioUringPort->ringFd != port)
+    {
+        ioUringPort = ioUringPort->next;
+    }
+    pthread_mutex_unlock(&s_ioUringPortsLock);
+    return ioUringPort;
+}
+
+static int32_t IoUringCreateSocketEventPort(int32_t* port)
+{
+    IoUringPort* ioUringPort = (IoUringPort*)calloc(1, sizeof(IoUringPort));
+    if (ioUringPort == NULL)
+    {
+        return Error_ENOMEM;
+    }
+
+    int32_t error = IoUringMapPort(ioUringPort);
+    if (error != Error_SUCCESS)
+    {
+        free(ioUringPort);
+        return error;
+    }
+
+    pthread_mutex_init(&ioUringPort->lock, NULL);
+
+    pthread_mutex_lock(&s_ioUringPortsLock);
+    ioUringPort->next = s_ioUringPorts;
+    s_ioUringPorts = ioUringPort;
+    pthread_mutex_unlock(&s_ioUringPortsLock);
+
+    *port = ioUringPort->ringFd;
+    return Error_SUCCESS;
+}
+
+static int32_t IoUringCloseSocketEventPort(IoUringPort* ioUringPort)
+{
+    pthread_mutex_lock(&s_ioUringPortsLock);
+    IoUringPort** link = &s_ioUringPorts;
+    while (*link != NULL && *link != ioUringPort)
+    {
+        link = &(*link)->next;
+    }
+    if (*link != NULL)
+    {
+        *link = ioUringPort->next;
+    }
+    pthread_mutex_unlock(&s_ioUringPortsLock);
+
+    for (int i = 0; i < IO_URING_REG_BUCKETS; i++)
+    {
+        IoUringRegistration* registration = ioUringPort->registrations[i];
+        while (registration != NULL)
+        {
+            IoUringRegistration* next = registration->next;
+            free(registration);
+            registration = next;
+        }
+    }
+
+    IoUringRegistration* defunct = ioUringPort->defunctRegistrations;
+    while (defunct != NULL)
+    {
+        IoUringRegistration* next = defunct->next;
+        free(defunct);
+        defunct = next;
+    }
+
+    IoUringUnmapPort(ioUringPort);
+    pthread_mutex_destroy(&ioUringPort->lock);
+    free(ioUringPort);
+    return Error_SUCCESS;
+}
+
+// Returns the link through which the registration for the socket hangs, so
+// the caller can unlink it in place. The port lock must be held.
+static IoUringRegistration** IoUringFindRegistration(IoUringPort* port, int32_t socket)
+{
+    IoUringRegistration** link = &port->registrations[(uint32_t)socket % IO_URING_REG_BUCKETS];
+    while (*link != NULL && (*link)->socket != socket)
+    {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+static void IoUringRetireRegistration(IoUringPort* port, IoUringRegistration* registration)
+{
+    if (registration->armed)
+    {
+        // Completions for the registration may still be in flight; cancel the
+        // poll and keep the node alive until its terminal completion arrives.
+        IoUringPreparePollRemove(port, registration);
+        registration->armed = 0;
+        registration->next = port->defunctRegistrations;
+        port->defunctRegistrations = registration;
+    }
+    else
+    {
+        free(registration);
+    }
+}
+
+static int32_t IoUringTryChangeSocketEventRegistration(
+    IoUringPort* port, int32_t socket, SocketEvents newEvents, uintptr_t data)
+{
+    int32_t error = Error_SUCCESS;
+    uint32_t toSubmit = 0;
+
+    pthread_mutex_lock(&port->lock);
+
+    IoUringRegistration** link = IoUringFindRegistration(port, socket);
+    IoUringRegistration* current = *link;
+    if (current != NULL)
+    {
+        // A multishot poll cannot have its mask changed in place, so any
+        // change replaces the existing registration.
+        *link = current->next;
+        uint32_t wasArmed = (uint32_t)current->armed;
+        IoUringRetireRegistration(port, current);
+        toSubmit += wasArmed;
+    }
+
+    if (newEvents != SocketEvents_SA_NONE)
+    {
+        IoUringRegistration* registration = (IoUringRegistration*)calloc(1, sizeof(IoUringRegistration));
+        if (registration == NULL)
+        {
+            error = Error_ENOMEM;
+        }
+        else
+        {
+            registration->socket = socket;
+            registration->data = data;
+            registration->events = GetEPollEvents(newEvents);
+            registration->next = port->registrations[(uint32_t)socket % IO_URING_REG_BUCKETS];
+            port->registrations[(uint32_t)socket % IO_URING_REG_BUCKETS] = registration;
+            IoUringPreparePollAdd(port, registration);
+            toSubmit++;
+        }
+    }
+
+    if (toSubmit != 0)
+    {
+        int32_t submitError = IoUringSubmit(port, toSubmit);
+        if (error == Error_SUCCESS)
+        {
+            error = submitError;
+        }
+    }
+
+    pthread_mutex_unlock(&port->lock);
+    return error;
+}
+
+static void IoUringFreeDefunctRegistration(IoUringPort* port, IoUringRegistration* registration)
+{
+    IoUringRegistration** link = &port->defunctRegistrations;
+    while (*link != NULL && *link != registration)
+    {
+        link = &(*link)->next;
+    }
+    if (*link != NULL)
+    {
+        *link = registration->next;
+        free(registration);
+    }
+}
+
+static int32_t IoUringWaitForSocketEvents(IoUringPort* port, SocketEvent* buffer, int32_t* count)
+{
+    assert(buffer != NULL);
+    assert(count != NULL);
+    assert(*count >= 0);
+
+    if (*count == 0)
+    {
+        return Error_EINVAL;
+    }
+
+    int32_t numEvents = 0;
+    while (numEvents == 0)
+    {
+        pthread_mutex_lock(&port->lock);
+
+        uint32_t head = *port->cqHead;
+        uint32_t tail = __atomic_load_n(port->cqTail, __ATOMIC_ACQUIRE);
+        uint32_t rearmed = 0;
+        int32_t error = Error_SUCCESS;
+
+        while (head != tail && numEvents < *count)
+        {
+            // This copy is made deliberately to avoid rereading ring memory.
+            struct io_uring_cqe cqe = port->cqes[head & port->cqMask];
+            head++;
+
+            if (cqe.user_data == IO_URING_CONTROL_UDATA)
+            {
+                continue;
+            }
+
+            IoUringRegistration* registration = (IoUringRegistration*)(uintptr_t)cqe.user_data;
+            int32_t terminal = (cqe.flags & IORING_CQE_F_MORE) == 0;
+
+            if (!registration->armed)
+            {
+                // The registration was retired; drop stale completions and
+                // free the node once its terminal completion is consumed.
+                if (terminal)
+                {
+                    IoUringFreeDefunctRegistration(port, registration);
+                }
+                continue;
+            }
+
+            uint32_t events;
+            if (cqe.res < 0)
+            {
+                // Surface a failed poll as an error event so the managed
+                // engine processes (and ultimately unregisters) the socket.
+                events = EPOLLERR;
+            }
+            else
+            {
+                events = (uint32_t)cqe.res;
+            }
+
+            if (terminal)
+            {
+                registration->armed = 0;
+                if (cqe.res >= 0)
+                {
+                    // The poll terminated without an error (e.g. after a
+                    // completion ring overflow); re-arm it to preserve the
+                    // multishot behavior. The completion ring is larger than
+                    // the submission ring, so flush once a full submission
+                    // batch accumulates - otherwise the tail would wrap over
+                    // entries the kernel has not consumed yet.
+                    IoUringPreparePollAdd(port, registration);
+                    rearmed++;
+                    if (rearmed == IO_URING_SQ_ENTRIES)
+                    {
+                        error = IoUringSubmit(port, rearmed);
+                        rearmed = 0;
+                        if (error != Error_SUCCESS)
+                        {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // As with epoll, report hang-up as read/write readiness: the
+            // usual processing for those events recognizes and handles the
+            // HUP condition.
+            if ((events & EPOLLHUP) != 0)
+            {
+                events = (events & ((uint32_t)~EPOLLHUP)) | EPOLLIN | EPOLLOUT;
+            }
+
+            memset(&buffer[numEvents], 0, sizeof(SocketEvent));
+            buffer[numEvents].Data = registration->data;
+            buffer[numEvents].Events = GetSocketEvents(events);
+            numEvents++;
+        }
+
+        __atomic_store_n(port->cqHead, head, __ATOMIC_RELEASE);
+
+        if (error == Error_SUCCESS && rearmed != 0)
+        {
+            error = IoUringSubmit(port, rearmed);
+        }
+
+        pthread_mutex_unlock(&port->lock);
+
+        if (error != Error_SUCCESS)
+        {
+            *count = 0;
+            return error;
+        }
+
+        if (numEvents == 0)
+        {
+            int err;
+            while ((err = IoUringEnter(port->ringFd, 0, 1, IORING_ENTER_GETEVENTS)) == -1 && errno == EINTR);
+            if (err == -1)
+            {
+                *count = 0;
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+        }
+    }
+
+    *count = numEvents;
+    return Error_SUCCESS;
+}
+
+#endif // HAVE_IO_URING
+
 static int32_t CreateSocketEventPortInner(int32_t* port)
 {
     assert(port != NULL);
 
+#if HAVE_IO_URING
+    if (IoUringEnabled() && IoUringCreateSocketEventPort(port) == Error_SUCCESS)
+    {
+        return Error_SUCCESS;
+    }
+#endif
+
     int epollFd = epoll_create1(EPOLL_CLOEXEC);
     if (epollFd == -1)
     {
@@ -2799,6 +3513,14 @@ static int32_t CreateSocketEventPortInner(int32_t* port)
 
 static int32_t CloseSocketEventPortInner(int32_t port)
 {
+#if HAVE_IO_URING
+    IoUringPort* ioUringPort = IoUringFindPort(port);
+    if (ioUringPort != NULL)
+    {
+        return IoUringCloseSocketEventPort(ioUringPort);
+    }
+#endif
+
     int err = close(port);
     return err == 0 || (err < 0 && errno == EINTR) ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
@@ -2808,6 +3530,14 @@ static int32_t TryChangeSocketEventRegistrationInner(
 {
     assert(currentEvents != newEvents);
 
+#if HAVE_IO_URING
+    IoUringPort* ioUringPort = IoUringFindPort(port);
+    if (ioUringPort != NULL)
+    {
+        return IoUringTryChangeSocketEventRegistration(ioUringPort, socket, newEvents, data);
+    }
+#endif
+
     int op = EPOLL_CTL_MOD;
     if (currentEvents == SocketEvents_SA_NONE)
     {
@@ -2852,6 +3582,14 @@ static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32
     assert(count != NULL);
     assert(*count >= 0);
 
+#if HAVE_IO_URING
+    IoUringPort* ioUringPort = IoUringFindPort(port);
+    if (ioUringPort != NULL)
+    {
+        return IoUringWaitForSocketEvents(ioUringPort, buffer, count);
+    }
+#endif
+
     struct epoll_event* events = (struct epoll_event*)buffer;
     int numEvents;
     while ((numEvents = epoll_wait(port, events, *count, -1)) < 0 && errno == EINTR);
@@ -3353,6 +4091,36 @@ error:
 #endif
 }
 
+int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int64_t* transferred)
+{
+    assert(transferred != NULL);
+
+#ifdef __linux__
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+
+    // SPLICE_F_MOVE asks the kernel to move pages instead of copying; it is
+    // advisory, so the transfer degrades to an in-kernel copy when moving is
+    // not possible. Payload bytes never surface in user space either way.
+    ssize_t res;
+    while ((res = splice(infd, NULL, outfd, NULL, (size_t)count, SPLICE_F_MOVE)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *transferred = res;
+        return Error_SUCCESS;
+    }
+
+    *transferred = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    (void)count;
+    *transferred = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
@@ -31,6 +31,9 @@
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
+#if HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+#include <spawn.h>
+#endif
 #endif
 
 #ifdef __FreeBSD__
@@ -209,6 +212,79 @@ handler_from_sigaction (struct sigaction *sa)
     }
 }
 
+#if defined(__APPLE__) && HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+// posix_spawn on Apple platforms is implemented as a single kernel call that
+// reports exec failures synchronously, so it avoids both fork's address-space
+// duplication in large parents (vfork is not trusted on these platforms, see
+// below) and the child-side setup. It cannot change credentials, so callers
+// that set them keep using the fork path.
+static int SpawnProcess(const char* filename,
+                        char* const argv[],
+                        char* const envp[],
+                        const char* cwd,
+                        int32_t redirectStdin,
+                        int32_t redirectStdout,
+                        int32_t redirectStderr,
+                        int stdinFds[2],
+                        int stdoutFds[2],
+                        int stderrFds[2],
+                        pid_t* processId)
+{
+    posix_spawn_file_actions_t fileActions;
+    posix_spawnattr_t attr;
+    sigset_t defaultSignals;
+    struct sigaction sa_old;
+    int error;
+
+    // Reset only signals with custom handlers back to the default disposition,
+    // matching what the fork path does from inside the child: SIG_IGN carries
+    // meaning across exec and is preserved, while custom handlers would be
+    // dangling in the new image.
+    sigemptyset(&defaultSignals);
+    for (int sig = 1; sig < NSIG; ++sig)
+    {
+        if (sig == SIGKILL || sig == SIGSTOP)
+        {
+            continue;
+        }
+        if (!sigaction(sig, NULL, &sa_old))
+        {
+            void (*oldhandler)(int) = handler_from_sigaction(&sa_old);
+            if (oldhandler != SIG_IGN && oldhandler != SIG_DFL)
+            {
+                sigaddset(&defaultSignals, sig);
+            }
+        }
+    }
+
+    error = posix_spawnattr_init(&attr);
+    if (error != 0)
+    {
+        return error;
+    }
+
+    if ((error = posix_spawnattr_setsigdefault(&attr, &defaultSignals)) == 0 &&
+        (error = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF)) == 0 &&
+        (error = posix_spawn_file_actions_init(&fileActions)) == 0)
+    {
+        // For any redirections that should happen, dup the pipe descriptors onto stdin/out/err;
+        // dup2 clears the close-on-exec flag on the resulting descriptors.
+        if ((cwd == NULL || (error = posix_spawn_file_actions_addchdir_np(&fileActions, cwd)) == 0) &&
+            (!redirectStdin || (error = posix_spawn_file_actions_adddup2(&fileActions, stdinFds[READ_END_OF_PIPE], STDIN_FILENO)) == 0) &&
+            (!redirectStdout || (error = posix_spawn_file_actions_adddup2(&fileActions, stdoutFds[WRITE_END_OF_PIPE], STDOUT_FILENO)) == 0) &&
+            (!redirectStderr || (error = posix_spawn_file_actions_adddup2(&fileActions, stderrFds[WRITE_END_OF_PIPE], STDERR_FILENO)) == 0))
+        {
+            error = posix_spawn(processId, filename, &fileActions, &attr, argv, envp);
+        }
+
+        posix_spawn_file_actions_destroy(&fileActions);
+    }
+
+    posix_spawnattr_destroy(&attr);
+    return error;
+}
+#endif
+
 int32_t SystemNative_ForkAndExecProcess(const char* filename,
                                       char* const argv[],
                                       char* const envp[],
@@ -309,6 +385,29 @@ int32_t SystemNative_ForkAndExecProcess(const char* filename,
     (void)! SystemNative_Pipe(waitForChildToExecPipe, PAL_O_CLOEXEC);
 #endif
 
+#if defined(__APPLE__) && HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+    if (!setCredentials)
+    {
+        int spawnError = SpawnProcess(
+            filename, argv, envp, cwd, redirectStdin, redirectStdout, redirectStderr,
+            stdinFds, stdoutFds, stderrFds, &processId);
+        if (spawnError != 0)
+        {
+            errno = spawnError;
+            success = false;
+            goto done;
+        }
+
+        // The child has already exec'ed; the exec waiting pipe is left unused and
+        // reads as closed in the shared cleanup below.
+        *childPid = processId;
+        *stdinFd = stdinFds[WRITE_END_OF_PIPE];
+        *stdoutFd = stdoutFds[READ_END_OF_PIPE];
+        *stderrFd = stderrFds[READ_END_OF_PIPE];
+        goto done;
+    }
+#endif
+
     // The fork child must not be signalled until it calls exec(): our signal handlers do not
     // handle being raised in the child process correctly
     sigfillset(&signal_set);
@@ -113,6 +113,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpAes256Ecb)
     DllImportEntry(CryptoNative_EvpAes256Gcm)
     DllImportEntry(CryptoNative_EvpChaCha20Poly1305)
+    DllImportEntry(CryptoNative_EvpCipherAeadDecryptBatch)
+    DllImportEntry(CryptoNative_EvpCipherAeadEncryptBatch)
     DllImportEntry(CryptoNative_EvpCipherCreate2)
     DllImportEntry(CryptoNative_EvpCipherCreatePartial)
     DllImportEntry(CryptoNative_EvpCipherCtxSetPadding)
@@ -141,6 +143,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestFinalXOF)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
+    DllImportEntry(CryptoNative_EvpDigestOneShotBatch)
     DllImportEntry(CryptoNative_EvpDigestReset)
     DllImportEntry(CryptoNative_EvpDigestSqueeze)
     DllImportEntry(CryptoNative_EvpDigestUpdate)
@@ -324,6 +327,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslCtxCheckPrivateKey)
     DllImportEntry(CryptoNative_SslCtxCreate)
     DllImportEntry(CryptoNative_SslCtxDestroy)
+    DllImportEntry(CryptoNative_SslCtxEnableKtls)
     DllImportEntry(CryptoNative_SslCtxGetData)
     DllImportEntry(CryptoNative_SslCtxSetAlpnSelectCb)
     DllImportEntry(CryptoNative_SslCtxSetData)
@@ -340,6 +344,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslGetData)
     DllImportEntry(CryptoNative_SslGetError)
     DllImportEntry(CryptoNative_SslGetFinished)
+    DllImportEntry(CryptoNative_SslGetKtlsStatus)
     DllImportEntry(CryptoNative_SslGetPeerCertChain)
     DllImportEntry(CryptoNative_SslGetPeerCertificate)
     DllImportEntry(CryptoNative_SslGetCertificate)
@@ -13,6 +13,97 @@
 static const EVP_MD* g_evpFetchMd5 = NULL;
 static pthread_once_t g_evpFetch = PTHREAD_ONCE_INIT;
 
+// One-shot digest operations are hot enough (HMAC-based token validation, hashing
+// small payloads) that allocating and freeing an EVP_MD_CTX per call is measurable.
+// Keep one context per thread and reinitialize it for the requested algorithm instead.
+static pthread_key_t g_oneShotMdCtxKey;
+static pthread_once_t g_oneShotMdCtxKeyInit = PTHREAD_ONCE_INIT;
+static int32_t g_oneShotMdCtxKeyCreated = 0;
+
+static void FreeOneShotMdCtx(void* ctx)
+{
+    EVP_MD_CTX_free((EVP_MD_CTX*)ctx);
+}
+
+static void EnsureOneShotMdCtxKey(void)
+{
+    // This is called from a pthread_once - this method should not be called directly.
+    g_oneShotMdCtxKeyCreated = pthread_key_create(&g_oneShotMdCtxKey, FreeOneShotMdCtx) == 0;
+}
+
+// Returns an EVP_MD_CTX initialized for type. When *pooled is set the context is
+// owned by the thread's cache and must not be freed; otherwise the caller frees it.
+static EVP_MD_CTX* AcquireDigestCtx(const EVP_MD* type, int32_t* pooled)
+{
+    *pooled = 0;
+
+    pthread_once(&g_oneShotMdCtxKeyInit, EnsureOneShotMdCtxKey);
+
+    EVP_MD_CTX* ctx = NULL;
+
+    if (g_oneShotMdCtxKeyCreated)
+    {
+        ctx = (EVP_MD_CTX*)pthread_getspecific(g_oneShotMdCtxKey);
+
+        if (ctx == NULL)
+        {
+            ctx = EVP_MD_CTX_new();
+
+            if (ctx != NULL && pthread_setspecific(g_oneShotMdCtxKey, ctx) != 0)
+            {
+                EVP_MD_CTX_free(ctx);
+                ctx = NULL;
+            }
+        }
+
+        if (ctx != NULL)
+        {
+            *pooled = 1;
+        }
+    }
+
+    if (ctx == NULL)
+    {
+        ctx = EVP_MD_CTX_new();
+
+        if (ctx == NULL)
+        {
+            // Allocation failed.
+            // This is one of the few places that don't report the error to the queue, so
+            // we'll do it here.
+            ERR_put_error(ERR_LIB_EVP, 0, ERR_R_MALLOC_FAILURE, __FILE__, __LINE__);
+            return NULL;
+        }
+    }
+
+    // For OpenSSL 1.x, set the non-FIPS allow flag for MD5. OpenSSL 3 does this differently with EVP_MD_fetch
+    // and no longer has this flag.
+    if (CryptoNative_OpenSslVersionNumber() < OPENSSL_VERSION_3_0_RTM && type == EVP_md5())
+    {
+        EVP_MD_CTX_set_flags(ctx, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
+    }
+
+    if (!EVP_DigestInit_ex(ctx, type, NULL))
+    {
+        if (!*pooled)
+        {
+            EVP_MD_CTX_free(ctx);
+        }
+
+        return NULL;
+    }
+
+    return ctx;
+}
+
+static void ReleaseDigestCtx(EVP_MD_CTX* ctx, int32_t pooled)
+{
+    if (!pooled)
+    {
+        EVP_MD_CTX_free(ctx);
+    }
+}
+
 static void EnsureFetchEvpMdAlgorithms(void)
 {
     // This is called from a pthread_once - this method should not be called directly.
@@ -211,7 +302,8 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
         return 0;
     }
 
-    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+    int32_t pooled;
+    EVP_MD_CTX* ctx = AcquireDigestCtx(type, &pooled);
 
     if (ctx == NULL)
     {
@@ -222,16 +314,75 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
 
     if (ret != SUCCESS)
     {
-        CryptoNative_EvpMdCtxDestroy(ctx);
+        ReleaseDigestCtx(ctx, pooled);
         return 0;
     }
 
     ret = CryptoNative_EvpDigestFinalEx(ctx, md, mdSize);
 
-    CryptoNative_EvpMdCtxDestroy(ctx);
+    ReleaseDigestCtx(ctx, pooled);
     return ret;
 }
 
+int32_t CryptoNative_EvpDigestOneShotBatch(const EVP_MD* type,
+                                           uint8_t** sources,
+                                           int32_t* sourceSizes,
+                                           uint8_t* destinations,
+                                           int32_t destinationStride,
+                                           uint32_t* destinationSizes,
+                                           int32_t count)
+{
+    ERR_clear_error();
+
+    if (type == NULL || sources == NULL || sourceSizes == NULL || destinations == NULL ||
+        destinationSizes == NULL || count < 0 || destinationStride < EVP_MD_get_size(type))
+    {
+        return 0;
+    }
+
+    int32_t pooled;
+    EVP_MD_CTX* ctx = AcquireDigestCtx(type, &pooled);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t completed = 0;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (sourceSizes[i] < 0 || (sources[i] == NULL && sourceSizes[i] != 0))
+        {
+            break;
+        }
+
+        // AcquireDigestCtx already initialized the context for the first message.
+        if (i > 0 && !EVP_DigestInit_ex(ctx, type, NULL))
+        {
+            break;
+        }
+
+        if (EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i]) != SUCCESS)
+        {
+            break;
+        }
+
+        unsigned int size;
+
+        if (EVP_DigestFinal_ex(ctx, destinations + (size_t)i * (size_t)destinationStride, &size) != SUCCESS)
+        {
+            break;
+        }
+
+        destinationSizes[i] = size;
+        completed++;
+    }
+
+    ReleaseDigestCtx(ctx, pooled);
+    return completed;
+}
+
 int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t len)
 {
     ERR_clear_error();
@@ -241,7 +392,8 @@ int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source,
         return 0;
     }
 
-    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+    int32_t pooled;
+    EVP_MD_CTX* ctx = AcquireDigestCtx(type, &pooled);
 
     if (ctx == NULL)
     {
@@ -252,13 +404,13 @@ int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source,
 
     if (ret != SUCCESS)
     {
-        CryptoNative_EvpMdCtxDestroy(ctx);
+        ReleaseDigestCtx(ctx, pooled);
         return 0;
     }
 
     ret = CryptoNative_EvpDigestFinalXOF(ctx, md, len);
 
-    CryptoNative_EvpMdCtxDestroy(ctx);
+    ReleaseDigestCtx(ctx, pooled);
     return ret;
 }
 
@@ -81,6 +81,25 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestOneShotBatch
+
+Computes one digest per entry in sources, reusing a single EVP_MD_CTX for the
+whole batch. The i-th digest is written at destinations + i * destinationStride,
+which must be at least the digest size for type, with its length stored in
+destinationSizes[i].
+
+Returns the number of digests computed; processing stops at the first failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestOneShotBatch(const EVP_MD* type,
+                                                     uint8_t** sources,
+                                                     int32_t* sourceSizes,
+                                                     uint8_t* destinations,
+                                                     int32_t destinationStride,
+                                                     uint32_t* destinationSizes,
+                                                     int32_t count);
+
 /*
 Function:
 EvpDigestXOFOneShot
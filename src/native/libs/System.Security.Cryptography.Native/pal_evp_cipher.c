@@ -233,6 +233,123 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+int32_t CryptoNative_EvpCipherAeadEncryptBatch(EVP_CIPHER_CTX* ctx,
+                                               uint8_t** nonces,
+                                               uint8_t** aads,
+                                               int32_t* aadLengths,
+                                               uint8_t** plaintexts,
+                                               int32_t* plaintextLengths,
+                                               uint8_t** ciphertexts,
+                                               uint8_t** tags,
+                                               int32_t tagLength,
+                                               int32_t count)
+{
+    ERR_clear_error();
+
+    if (ctx == NULL || nonces == NULL || plaintexts == NULL || plaintextLengths == NULL ||
+        ciphertexts == NULL || tags == NULL || tagLength <= 0 || count < 0)
+    {
+        return 0;
+    }
+
+    int32_t completed = 0;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        int outLength;
+
+        // Rewind the keyed context to the new nonce; the key schedule is preserved.
+        if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, nonces[i], KEEP_CURRENT_DIRECTION))
+        {
+            break;
+        }
+
+        if (aads != NULL && aadLengths != NULL && aadLengths[i] > 0 &&
+            !EVP_CipherUpdate(ctx, NULL, &outLength, aads[i], aadLengths[i]))
+        {
+            break;
+        }
+
+        if (!EVP_CipherUpdate(ctx, ciphertexts[i], &outLength, plaintexts[i], plaintextLengths[i]))
+        {
+            break;
+        }
+
+        if (!EVP_CipherFinal_ex(ctx, ciphertexts[i] + outLength, &outLength))
+        {
+            break;
+        }
+
+        if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, tagLength, tags[i]))
+        {
+            break;
+        }
+
+        completed++;
+    }
+
+    return completed;
+}
+
+int32_t CryptoNative_EvpCipherAeadDecryptBatch(EVP_CIPHER_CTX* ctx,
+                                               uint8_t** nonces,
+                                               uint8_t** aads,
+                                               int32_t* aadLengths,
+                                               uint8_t** ciphertexts,
+                                               int32_t* ciphertextLengths,
+                                               uint8_t** plaintexts,
+                                               uint8_t** tags,
+                                               int32_t tagLength,
+                                               int32_t count)
+{
+    ERR_clear_error();
+
+    if (ctx == NULL || nonces == NULL || ciphertexts == NULL || ciphertextLengths == NULL ||
+        plaintexts == NULL || tags == NULL || tagLength <= 0 || count < 0)
+    {
+        return 0;
+    }
+
+    int32_t completed = 0;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        int outLength;
+
+        if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, nonces[i], KEEP_CURRENT_DIRECTION))
+        {
+            break;
+        }
+
+        if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, tagLength, tags[i]))
+        {
+            break;
+        }
+
+        if (aads != NULL && aadLengths != NULL && aadLengths[i] > 0 &&
+            !EVP_CipherUpdate(ctx, NULL, &outLength, aads[i], aadLengths[i]))
+        {
+            break;
+        }
+
+        if (!EVP_CipherUpdate(ctx, plaintexts[i], &outLength, ciphertexts[i], ciphertextLengths[i]))
+        {
+            break;
+        }
+
+        // For an AEAD cipher the final call performs the tag check; a mismatch
+        // stops the batch so the caller can tell exactly which message failed.
+        if (!EVP_CipherFinal_ex(ctx, plaintexts[i] + outLength, &outLength))
+        {
+            break;
+        }
+
+        completed++;
+    }
+
+    return completed;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
     // No error queue impact.
@@ -110,6 +110,49 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpCipherAeadEncryptBatch
+
+Encrypts count independent messages with a keyed AEAD context, re-initializing
+it with nonces[i] for each message instead of paying a context setup per call.
+The i-th ciphertext and its authentication tag are written to ciphertexts[i]
+and tags[i]. aads may be NULL when no messages carry associated data.
+
+Returns the number of messages encrypted; processing stops at the first failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadEncryptBatch(EVP_CIPHER_CTX* ctx,
+                                                         uint8_t** nonces,
+                                                         uint8_t** aads,
+                                                         int32_t* aadLengths,
+                                                         uint8_t** plaintexts,
+                                                         int32_t* plaintextLengths,
+                                                         uint8_t** ciphertexts,
+                                                         uint8_t** tags,
+                                                         int32_t tagLength,
+                                                         int32_t count);
+
+/*
+Function:
+EvpCipherAeadDecryptBatch
+
+Decrypts count independent messages with a keyed AEAD context, verifying
+tags[i] for each. Processing stops at the first failure, including an
+authentication tag mismatch, so the return value identifies the failed message.
+
+Returns the number of messages decrypted and authenticated.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadDecryptBatch(EVP_CIPHER_CTX* ctx,
+                                                         uint8_t** nonces,
+                                                         uint8_t** aads,
+                                                         int32_t* aadLengths,
+                                                         uint8_t** ciphertexts,
+                                                         int32_t* ciphertextLengths,
+                                                         uint8_t** plaintexts,
+                                                         uint8_t** tags,
+                                                         int32_t tagLength,
+                                                         int32_t count);
+
 /*
 Function:
 EvpAes128Ecb
@@ -242,6 +242,72 @@ SSL_CTX* CryptoNative_SslCtxCreate(const SSL_METHOD* method)
     return ctx;
 }
 
+int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx)
+{
+    // No error queue impact.
+
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS ((uint64_t)1 << (uint64_t)3)
+#endif
+
+    // Kernel TLS offload is only wired up in OpenSSL 3.0+; on older versions the
+    // option bit is unassigned, so setting it could mean something else entirely.
+    if (CryptoNative_OpenSslVersionNumber() < OPENSSL_VERSION_3_0_RTM)
+    {
+        return 0;
+    }
+
+    // Enabling the option only makes offload possible; whether the handshake
+    // actually lands on kTLS depends on the negotiated cipher, the kernel, and
+    // the BIO being backed by a socket. Callers query SslGetKtlsStatus after
+    // the handshake to find out.
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"
+    SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+#pragma clang diagnostic pop
+    return 1;
+}
+
+int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl, int32_t* sendOffloaded, int32_t* receiveOffloaded)
+{
+    // No error queue impact.
+
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+#ifndef BIO_CTRL_GET_KTLS_RECV
+#define BIO_CTRL_GET_KTLS_RECV 76
+#endif
+
+    if (ssl == NULL || sendOffloaded == NULL || receiveOffloaded == NULL)
+    {
+        return 0;
+    }
+
+    *sendOffloaded = 0;
+    *receiveOffloaded = 0;
+
+    if (CryptoNative_OpenSslVersionNumber() >= OPENSSL_VERSION_3_0_RTM)
+    {
+        // Expanded forms of BIO_get_ktls_send and BIO_get_ktls_recv; on a BIO that
+        // predates kTLS the unknown ctrl just returns 0.
+        BIO* wbio = SSL_get_wbio(ssl);
+        BIO* rbio = SSL_get_rbio(ssl);
+
+        if (wbio != NULL)
+        {
+            *sendOffloaded = BIO_ctrl(wbio, BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0;
+        }
+
+        if (rbio != NULL)
+        {
+            *receiveOffloaded = BIO_ctrl(rbio, BIO_CTRL_GET_KTLS_RECV, 0, NULL) > 0;
+        }
+    }
+
+    return 1;
+}
+
 /*
 Openssl supports setting ecdh curves by default from version 1.1.0.
 For lower versions, this is the recommended approach.
@@ -150,6 +150,23 @@ Returns the new SSL_CTX instance.
 */
 PALEXPORT SSL_CTX* CryptoNative_SslCtxCreate(const SSL_METHOD* method);
 
+/*
+Sets SSL_OP_ENABLE_KTLS in the SSL_CTX options so record processing can be
+offloaded to the kernel when the cipher, kernel, and underlying BIO allow it.
+
+Returns 1 if the option was set, 0 when the OpenSSL version has no kTLS support.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxEnableKtls(SSL_CTX* ctx);
+
+/*
+Queries whether the kernel took over record encryption (send) and decryption
+(receive) for the connection, via BIO_get_ktls_send and BIO_get_ktls_recv.
+Both values are 0 when the OpenSSL version has no kTLS support.
+
+Returns 1 on success, 0 on invalid arguments.
+*/
+PALEXPORT int32_t CryptoNative_SslGetKtlsStatus(SSL* ssl, int32_t* sendOffloaded, int32_t* receiveOffloaded);
+
 /*
 Sets the specified protocols in the SSL_CTX options.
 */
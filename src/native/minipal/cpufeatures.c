@@ -19,6 +19,10 @@
 #define PF_ARM_SVE_INSTRUCTIONS_AVAILABLE (46)
 #endif
 
+#ifndef PF_ARM_SVE2_INSTRUCTIONS_AVAILABLE
+#define PF_ARM_SVE2_INSTRUCTIONS_AVAILABLE (47)
+#endif
+
 #else // HOST_WINDOWS
 
 #include "minipalconfig.h"
@@ -44,6 +48,9 @@
 #ifndef HWCAP_SVE
 #define HWCAP_SVE   (1 << 22)
 #endif
+#ifndef HWCAP2_SVE2
+#define HWCAP2_SVE2 (1 << 1)
+#endif
 
 #endif
 
@@ -99,6 +106,22 @@ static uint32_t avx512StateSupport()
 #endif
 }
 
+static uint32_t apxStateSupport()
+{
+#if defined(HOST_APPLE)
+    return 0;
+#else
+    uint32_t eax;
+    __asm("  xgetbv\n" \
+        : "=a"(eax) /*output in eax*/\
+        : "c"(0) /*inputs - 0 in ecx*/\
+        : "edx" /* registers that are clobbered*/
+      );
+    // check OS has enabled the extended GPR state component
+    return ((eax & 0x80000) == 0x80000) ? 1 : 0;
+#endif
+}
+
 static bool IsAvxEnabled()
 {
     return true;
@@ -125,6 +148,13 @@ static uint32_t avx512StateSupport()
     return ((_xgetbv(0) & 0xE6) == 0x0E6) ? 1 : 0;
 }
 
+static uint32_t apxStateSupport()
+{
+    // The Windows SDK does not expose an XState mask for the extended GPR
+    // state component yet, so APX cannot be safely enabled here.
+    return 0;
+}
+
 static bool IsAvxEnabled()
 {
     DWORD64 FeatureMask = GetEnabledXStateFeatures();
@@ -252,6 +282,12 @@ int minipal_getcpufeatures(void)
                                         result |= XArchIntrinsicConstants_AvxVnni;
                                     }
 
+                                    if (((cpuidInfo[CPUID_EDX] & (1 << 21)) != 0) &&                            // APX
+                                        (apxStateSupport() == 1))                                               // XGETBV XRC0[19] == 1
+                                    {
+                                        result |= XArchIntrinsicConstants_Apx;
+                                    }
+
                                     if ((cpuidInfo[CPUID_EDX] & (1 << 19)) != 0)                                // Avx10
                                     {
                                         __cpuidex(cpuidInfo, 0x00000024, 0x00000000);
@@ -270,6 +306,16 @@ int minipal_getcpufeatures(void)
                                             {
                                                 result |= XArchIntrinsicConstants_Avx10v1_V512;
                                             }
+
+                                            if (avx10Version >= 2)
+                                            {
+                                                result |= XArchIntrinsicConstants_Avx10v2;
+
+                                                if (isV512Supported)
+                                                {
+                                                    result |= XArchIntrinsicConstants_Avx10v2_V512;
+                                                }
+                                            }
                                         }
                                     }
                                 }
@@ -320,40 +366,39 @@ int minipal_getcpufeatures(void)
 #if defined(HOST_UNIX)
 
 #if HAVE_AUXV_HWCAP_H
-    unsigned long hwCap = getauxval(AT_HWCAP);
-
-    if (hwCap & HWCAP_AES)
-        result |= ARM64IntrinsicConstants_Aes;
-
-    if (hwCap & HWCAP_ATOMICS)
-        result |= ARM64IntrinsicConstants_Atomics;
-
-    if (hwCap & HWCAP_CRC32)
-        result |= ARM64IntrinsicConstants_Crc32;
-
-    if (hwCap & HWCAP_ASIMDDP)
-        result |= ARM64IntrinsicConstants_Dp;
-
-    if (hwCap & HWCAP_LRCPC)
-        result |= ARM64IntrinsicConstants_Rcpc;
-
-    if (hwCap & HWCAP_ILRCPC)
-        result |= ARM64IntrinsicConstants_Rcpc2;
-
-    if (hwCap & HWCAP_SHA1)
-        result |= ARM64IntrinsicConstants_Sha1;
+    // Features that map directly onto a single AT_HWCAP bit.
+    static const struct
+    {
+        unsigned long hwCapFlag;
+        int intrinsicConstant;
+    }
+    hwCapMap[] =
+    {
+        { HWCAP_AES,      ARM64IntrinsicConstants_Aes },
+        { HWCAP_ATOMICS,  ARM64IntrinsicConstants_Atomics },
+        { HWCAP_CRC32,    ARM64IntrinsicConstants_Crc32 },
+        { HWCAP_ASIMDDP,  ARM64IntrinsicConstants_Dp },
+        { HWCAP_LRCPC,    ARM64IntrinsicConstants_Rcpc },
+        { HWCAP_ILRCPC,   ARM64IntrinsicConstants_Rcpc2 },
+        { HWCAP_SHA1,     ARM64IntrinsicConstants_Sha1 },
+        { HWCAP_SHA2,     ARM64IntrinsicConstants_Sha256 },
+        { HWCAP_ASIMD,    ARM64IntrinsicConstants_AdvSimd },
+        { HWCAP_ASIMDRDM, ARM64IntrinsicConstants_Rdm },
+        { HWCAP_SVE,      ARM64IntrinsicConstants_Sve },
+    };
 
-    if (hwCap & HWCAP_SHA2)
-        result |= ARM64IntrinsicConstants_Sha256;
+    unsigned long hwCap = getauxval(AT_HWCAP);
 
-    if (hwCap & HWCAP_ASIMD)
-        result |= ARM64IntrinsicConstants_AdvSimd;
+    for (size_t i = 0; i < sizeof(hwCapMap) / sizeof(hwCapMap[0]); i++)
+    {
+        if (hwCap & hwCapMap[i].hwCapFlag)
+            result |= hwCapMap[i].intrinsicConstant;
+    }
 
-    if (hwCap & HWCAP_ASIMDRDM)
-        result |= ARM64IntrinsicConstants_Rdm;
+    unsigned long hwCap2 = getauxval(AT_HWCAP2);
 
-    if (hwCap & HWCAP_SVE)
-        result |= ARM64IntrinsicConstants_Sve;
+    if ((hwCap2 & HWCAP2_SVE2) && (result & ARM64IntrinsicConstants_Sve))
+        result |= ARM64IntrinsicConstants_Sve2;
 
 #else // !HAVE_AUXV_HWCAP_H
 
@@ -432,6 +477,11 @@ int minipal_getcpufeatures(void)
     if (IsProcessorFeaturePresent(PF_ARM_SVE_INSTRUCTIONS_AVAILABLE))
     {
         result |= ARM64IntrinsicConstants_Sve;
+
+        if (IsProcessorFeaturePresent(PF_ARM_SVE2_INSTRUCTIONS_AVAILABLE))
+        {
+            result |= ARM64IntrinsicConstants_Sve2;
+        }
     }
 
 #endif // HOST_WINDOWS
@@ -32,6 +32,9 @@ enum XArchIntrinsicConstants
     XArchIntrinsicConstants_Avx10v1 = 0x40000,
     XArchIntrinsicConstants_Avx10v1_V512 = 0x80000,
     XArchIntrinsicConstants_Evex = 0x100000,
+    XArchIntrinsicConstants_Avx10v2 = 0x200000,
+    XArchIntrinsicConstants_Avx10v2_V512 = 0x400000,
+    XArchIntrinsicConstants_Apx = 0x800000,
 };
 #endif // HOST_X86 || HOST_AMD64
 
@@ -49,6 +52,7 @@ enum ARM64IntrinsicConstants
     ARM64IntrinsicConstants_Rcpc = 0x0100,
     ARM64IntrinsicConstants_Rcpc2 = 0x0200,
     ARM64IntrinsicConstants_Sve = 0x0400,
+    ARM64IntrinsicConstants_Sve2 = 0x0800,
 };
 
 #include <assert.h>
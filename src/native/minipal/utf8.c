@@ -31,6 +31,207 @@ static bool IsSurrogate(const CHAR16_T c)
     return (c & 0xF800) == HIGH_SURROGATE_START;
 }
 
+// Vectorized helpers for the ASCII fast paths of the conversion loops below.
+// SSE2 and NEON are baseline on the architectures that compile these blocks
+// (which are all little-endian), so the dispatch is resolved at compile time.
+// Each helper consumes whole vectors from a leading ASCII run and returns the
+// number of elements processed; the scalar loops pick up from wherever the
+// helper stopped.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <emmintrin.h>
+
+// Returns the length of the leading all-ASCII run of whole 16-byte blocks.
+static size_t AsciiRunLengthUtf8(const unsigned char* pSrc, size_t count)
+{
+    size_t i = 0;
+
+    while (i + 16 <= count)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(pSrc + i));
+
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        i += 16;
+    }
+
+    return i;
+}
+
+// Returns the length of the leading all-ASCII run of whole 8-char blocks.
+static size_t AsciiRunLengthUtf16(const CHAR16_T* pSrc, size_t count)
+{
+    size_t i = 0;
+    const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+
+    while (i + 8 <= count)
+    {
+        __m128i chars = _mm_loadu_si128((const __m128i*)(pSrc + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, nonAscii), _mm_setzero_si128())) != 0xFFFF)
+            break;
+
+        i += 8;
+    }
+
+    return i;
+}
+
+// Widens a leading all-ASCII run of bytes to UTF-16. The caller must have
+// checked there is output room for one char per input byte.
+static size_t WidenAsciiRun(const unsigned char* pSrc, CHAR16_T* pTarget, size_t count)
+{
+    size_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+
+    while (i + 16 <= count)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(pSrc + i));
+
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        _mm_storeu_si128((__m128i*)(pTarget + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)(pTarget + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        i += 16;
+    }
+
+    return i;
+}
+
+// Narrows a leading all-ASCII run of UTF-16 chars to bytes. The caller must
+// have checked there is output room for one byte per input char.
+static size_t NarrowAsciiRun(const CHAR16_T* pSrc, unsigned char* pTarget, size_t count)
+{
+    size_t i = 0;
+    const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+
+    while (i + 16 <= count)
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(pSrc + i));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(pSrc + i + 8));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(lo, hi), nonAscii), _mm_setzero_si128())) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128((__m128i*)(pTarget + i), _mm_packus_epi16(lo, hi));
+        i += 16;
+    }
+
+    return i;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+static size_t AsciiRunLengthUtf8(const unsigned char* pSrc, size_t count)
+{
+    size_t i = 0;
+
+    while (i + 16 <= count)
+    {
+        uint8x16_t bytes = vld1q_u8(pSrc + i);
+
+        if (vmaxvq_u8(bytes) > 0x7F)
+            break;
+
+        i += 16;
+    }
+
+    return i;
+}
+
+static size_t AsciiRunLengthUtf16(const CHAR16_T* pSrc, size_t count)
+{
+    size_t i = 0;
+
+    while (i + 8 <= count)
+    {
+        uint16x8_t chars = vld1q_u16((const uint16_t*)(pSrc + i));
+
+        if (vmaxvq_u16(chars) > 0x7F)
+            break;
+
+        i += 8;
+    }
+
+    return i;
+}
+
+static size_t WidenAsciiRun(const unsigned char* pSrc, CHAR16_T* pTarget, size_t count)
+{
+    size_t i = 0;
+
+    while (i + 16 <= count)
+    {
+        uint8x16_t bytes = vld1q_u8(pSrc + i);
+
+        if (vmaxvq_u8(bytes) > 0x7F)
+            break;
+
+        vst1q_u16((uint16_t*)(pTarget + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16((uint16_t*)(pTarget + i + 8), vmovl_u8(vget_high_u8(bytes)));
+        i += 16;
+    }
+
+    return i;
+}
+
+static size_t NarrowAsciiRun(const CHAR16_T* pSrc, unsigned char* pTarget, size_t count)
+{
+    size_t i = 0;
+
+    while (i + 16 <= count)
+    {
+        uint16x8_t lo = vld1q_u16((const uint16_t*)(pSrc + i));
+        uint16x8_t hi = vld1q_u16((const uint16_t*)(pSrc + i + 8));
+
+        if (vmaxvq_u16(vorrq_u16(lo, hi)) > 0x7F)
+            break;
+
+        vst1q_u8(pTarget + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+        i += 16;
+    }
+
+    return i;
+}
+
+#else // no vector unit available, leave everything to the scalar loops
+
+static size_t AsciiRunLengthUtf8(const unsigned char* pSrc, size_t count)
+{
+    (void)pSrc;
+    (void)count;
+    return 0;
+}
+
+static size_t AsciiRunLengthUtf16(const CHAR16_T* pSrc, size_t count)
+{
+    (void)pSrc;
+    (void)count;
+    return 0;
+}
+
+static size_t WidenAsciiRun(const unsigned char* pSrc, CHAR16_T* pTarget, size_t count)
+{
+    (void)pSrc;
+    (void)pTarget;
+    (void)count;
+    return 0;
+}
+
+static size_t NarrowAsciiRun(const CHAR16_T* pSrc, unsigned char* pTarget, size_t count)
+{
+    (void)pSrc;
+    (void)pTarget;
+    (void)count;
+    return 0;
+}
+
+#endif
+
 typedef struct
 {
     // Store our default string
@@ -558,6 +759,10 @@ static size_t GetCharCount(UTF8Encoding* self, unsigned char* bytes, size_t coun
         // Also, we need 7 chars reserve for the unrolled ansi decoding loop and for decoding of multibyte sequences
         unsigned char *pStop = pSrc + availableBytes - 7;
 
+        // skip over a leading run of ASCII bytes in bulk; no count adjustment is
+        // needed since one char per byte was assumed up front
+        pSrc += AsciiRunLengthUtf8(pSrc, availableBytes);
+
         while (pSrc < pStop)
         {
             ch = *pSrc;
@@ -1024,6 +1229,12 @@ static size_t GetChars(UTF8Encoding* self, unsigned char* bytes, size_t byteCoun
         // Also, we need 7 chars reserve for the unrolled ansi decoding loop and for decoding of multibyte sequences
         CHAR16_T *pStop = pTarget + availableBytes - 7;
 
+        // widen a leading run of ASCII bytes in bulk; availableBytes was clamped
+        // above so there is output room for one char per byte
+        size_t asciiRun = WidenAsciiRun(pSrc, pTarget, availableBytes);
+        pSrc += asciiRun;
+        pTarget += asciiRun;
+
         while (pTarget < pStop)
         {
             ch = *pSrc;
@@ -1561,6 +1772,12 @@ static size_t GetBytes(UTF8Encoding* self, CHAR16_T* chars, size_t charCount, un
         // If there aren't enough bytes for the output, then pStop will be <= pSrc and will bypass the loop.
         CHAR16_T *pStop = pSrc + availableChars - 5;
 
+        // narrow a leading run of ASCII chars in bulk; availableChars was clamped
+        // above so there is output room for one byte per char
+        size_t asciiRun = NarrowAsciiRun(pSrc, pTarget, availableChars);
+        pSrc += asciiRun;
+        pTarget += asciiRun;
+
         while (pSrc < pStop)
         {
             ch = *pSrc;
@@ -1919,6 +2136,10 @@ static size_t GetByteCount(UTF8Encoding* self, CHAR16_T *chars, size_t count)
         // Also, we need 3 + 4 chars reserve for the unrolled ansi decoding loop and for decoding of surrogates
         CHAR16_T *pStop = pSrc + availableChars - (3 + 4);
 
+        // skip over a leading run of ASCII chars in bulk; no count adjustment is
+        // needed since one byte per char was assumed up front
+        pSrc += AsciiRunLengthUtf16(pSrc, availableChars);
+
         while (pSrc < pStop)
         {
             ch = *pSrc;